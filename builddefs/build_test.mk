@@ -4,7 +4,12 @@ endif
 
 .DEFAULT_GOAL := all
 
+# Benchmarks are timed, so they are optimised for size like firmware builds
+ifneq ($(findstring tests/benchmark/,$(TEST_PATH)),)
+OPT = s
+else
 OPT = g
+endif
 
 include paths.mk
 include $(BUILDDEFS_PATH)/message.mk
@@ -44,6 +44,7 @@ GENERIC_FEATURES = \
     OS_DETECTION \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
+    SCAN_PROFILER \
     SECURE \
     SEND_STRING \
     SEQUENCER \
@@ -18,6 +18,11 @@
 #include <string.h>
 
 #include "eeprom_driver.h"
+#if defined(EEPROM_I2C)
+#    include "eeprom_i2c.h"
+#elif defined(EEPROM_SPI)
+#    include "eeprom_spi.h"
+#endif
 
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
@@ -49,11 +54,36 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
     eeprom_write_block(&value, addr, 4);
 }
 
-void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+/* Updates are compared and written in chunks aligned to the underlying page size, so that each chunk which differs
+ * results in a single page write on external EEPROMs. The I2C and SPI driver headers above provide the page size of the
+ * configured part, or their own default. */
+#ifndef EEPROM_UPDATE_BLOCK_CHUNK_SIZE
+#    ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#        define EEPROM_UPDATE_BLOCK_CHUNK_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#    else
+#        define EEPROM_UPDATE_BLOCK_CHUNK_SIZE 32
+#    endif
+#endif
+
+__attribute__((weak)) void eeprom_update_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src    = (const uint8_t *)buf;
+    uintptr_t      target = (uintptr_t)addr;
+    uint8_t        read_buf[EEPROM_UPDATE_BLOCK_CHUNK_SIZE];
+
+    while (len > 0) {
+        size_t chunk = EEPROM_UPDATE_BLOCK_CHUNK_SIZE - (target % EEPROM_UPDATE_BLOCK_CHUNK_SIZE);
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        eeprom_read_block(read_buf, (const void *)target, chunk);
+        if (memcmp(src, read_buf, chunk) != 0) {
+            eeprom_write_block(src, (void *)target, chunk);
+        }
+
+        src += chunk;
+        target += chunk;
+        len -= chunk;
     }
 }
 
@@ -27,3 +27,8 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+void eeprom_update_block(const void *buf, void *addr, size_t len) {
+    /* wear leveling already skips writes of unchanged data, so there's no need to read back first. */
+    wear_leveling_write((uint32_t)addr, buf, len);
+}
@@ -165,6 +165,12 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#if OLED_SHADOW_BUFFER
+// Copy of the buffer as it was last sent to the display, so only what changed
+// since gets sent, and blocks for which the display is known to match it
+static uint8_t         oled_sent_buffer[OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_sent_blocks = 0;
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -363,6 +369,9 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+#if OLED_SHADOW_BUFFER
+    oled_sent_blocks = 0;
+#endif
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -382,29 +391,90 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
-    // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
-#if !OLED_IC_HAS_HORIZONTAL_MODE
-    // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
-    // Column value must be split into high and low nybble and sent as two commands.
-    cmd_array[0] = PAM_PAGE_ADDR | start_page;
-    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+// Sends a window of the display memory, with the data for each page of the window in turn
+static bool oled_send_window(uint8_t start_page, uint8_t end_page, uint8_t start_column, uint8_t end_column, const uint8_t *data) {
+    const uint8_t width = end_column - start_column + 1;
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    // Horizontal Addressing Mode wraps to the start of the next page at the end column of the window
+    uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, OLED_COLUMN_OFFSET + start_column, OLED_COLUMN_OFFSET + end_column, PAGE_ADDR, start_page, end_page};
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+    if (!oled_send_data(data, width * (end_page - start_page + 1))) {
+        print("oled_render data failed\n");
+        return false;
+    }
 #else
-    // Commands for use in Horizontal Addressing mode.
-    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
-    cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    // Page Addressing Mode has no end bound, so each page is sent separately.
+    // Column value must be split into high and low nybble and sent as two commands.
+    for (uint8_t page = start_page; page <= end_page; ++page) {
+        uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f), PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f)};
+        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+            print("oled_render offset command failed\n");
+            return false;
+        }
+        if (!oled_send_data(data, width)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+        data += width;
+    }
 #endif
+    return true;
 }
 
-static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
+static bool oled_render_block(uint8_t block) {
+    // The buffer has the same layout as the display memory, so each page of the
+    // block is sent as is, trimmed to the columns which changed since last sent
+    uint16_t start = OLED_BLOCK_SIZE * block;
+    uint16_t end   = start + OLED_BLOCK_SIZE;
+    while (start < end) {
+        uint16_t page_end = MIN(end, (start / OLED_DISPLAY_WIDTH + 1) * OLED_DISPLAY_WIDTH);
+        uint16_t first    = start;
+        uint16_t last     = page_end;
+#if OLED_SHADOW_BUFFER
+        if (oled_sent_blocks & ((OLED_BLOCK_TYPE)1 << block)) {
+            while (first < last && oled_buffer[first] == oled_sent_buffer[first]) {
+                ++first;
+            }
+            while (last > first && oled_buffer[last - 1] == oled_sent_buffer[last - 1]) {
+                --last;
+            }
+        }
+#endif
+        if (first < last) {
+            uint8_t page = first / OLED_DISPLAY_WIDTH;
+            if (!oled_send_window(page, page, first % OLED_DISPLAY_WIDTH, (last - 1) % OLED_DISPLAY_WIDTH, &oled_buffer[first])) {
+                return false;
+            }
+        }
+        start = page_end;
+    }
+    return true;
+}
+
+uint8_t crot(uint8_t a, int8_t n) {
+    const uint8_t mask = 0x7;
+    n &= mask;
+    return a << n | a >> (-n & mask);
+}
+
+static void rotate_90(const uint8_t *src, uint8_t *dest) {
+    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
+        uint8_t selector = (1 << i);
+        for (uint8_t j = 0; j < 8; ++j) {
+            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+        }
+    }
+}
+
+static bool oled_render_block_90(uint8_t block) {
     // Block numbering starts from the bottom left corner, going up and then to
-    // the right.  The controller needs the page and column numbers for the top
-    // left and bottom right corners of that block.
+    // the right.  Each block is rotated into a window of the display which is
+    // columns_in_block wide, and num_pages tall.
+    const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+    const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
 
     // Total number of pages across the screen height.
     const uint8_t height_in_pages = OLED_DISPLAY_HEIGHT / 8;
@@ -416,34 +486,47 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
     // Top page number for a block which is at the bottom edge of the screen.
     const uint8_t bottom_block_top_page = (height_in_pages - page_inc_per_block) % height_in_pages;
 
-#if !OLED_IC_HAS_HORIZONTAL_MODE
-    // Only the Page Addressing Mode is supported
-    uint8_t start_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
-    cmd_array[0]         = PAM_PAGE_ADDR | start_page;
-    cmd_array[1]         = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2]         = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
-#else
-    cmd_array[1] = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8 + OLED_COLUMN_OFFSET;
-    cmd_array[4] = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8 - 1 + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) % OLED_DISPLAY_HEIGHT / 8 + cmd_array[4];
+    const uint8_t block_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * block % OLED_DISPLAY_HEIGHT / 8);
+    const uint8_t block_column = OLED_BLOCK_SIZE * block / OLED_DISPLAY_HEIGHT * 8;
+
+    // Each 8x8 tile of the block lands at target_map[i] within the window, find
+    // the tiles which changed since last sent, only those need to be sent
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    uint8_t start_page = num_pages, end_page = 0, start_column = columns_in_block, end_column = 0;
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+#if OLED_SHADOW_BUFFER
+        uint16_t index = OLED_BLOCK_SIZE * block + source_map[i];
+        if ((oled_sent_blocks & ((OLED_BLOCK_TYPE)1 << block)) && !memcmp(&oled_buffer[index], &oled_sent_buffer[index], 8)) {
+            continue;
+        }
 #endif
-}
+        start_page   = MIN(start_page, target_map[i] / columns_in_block);
+        end_page     = MAX(end_page, target_map[i] / columns_in_block);
+        start_column = MIN(start_column, target_map[i] % columns_in_block);
+        end_column   = MAX(end_column, target_map[i] % columns_in_block + 7);
+    }
+    if (start_page > end_page) {
+        return true;
+    }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
-}
+    // Rotate the tiles within the window of changed tiles, unchanged tiles
+    // outside of it are left alone
+    const uint8_t width = end_column - start_column + 1;
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+    static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+    memset(temp_buffer, 0, sizeof(temp_buffer));
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        uint8_t page   = target_map[i] / columns_in_block;
+        uint8_t column = target_map[i] % columns_in_block;
+        if (page < start_page || page > end_page || column < start_column || column > end_column) {
+            continue;
         }
+        rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &temp_buffer[(page - start_page) * width + column - start_column]);
     }
+
+    return oled_send_window(block_page + start_page, block_page + end_page, block_column + start_column, block_column + end_column, temp_buffer);
 }
 
 void oled_render_dirty(bool all) {
@@ -464,69 +547,22 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        }
-
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
-            return;
-        }
-
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
+            if (!oled_render_block(update_start)) {
                 return;
             }
         } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
-
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
+            if (!oled_render_block_90(update_start)) {
                 return;
             }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
-            }
-#endif
         }
 
+#if OLED_SHADOW_BUFFER
+        // The display now matches the buffer for this block
+        memcpy(&oled_sent_buffer[OLED_BLOCK_SIZE * update_start], &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE);
+        oled_sent_blocks |= ((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
@@ -878,6 +914,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#if OLED_SHADOW_BUFFER
+        // Scrolling moved the contents of the display memory around
+        oled_sent_blocks = 0;
+#endif
     }
     return !oled_scrolling;
 }
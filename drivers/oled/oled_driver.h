@@ -321,6 +321,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// Only send the columns which changed since they were last sent, at the cost of OLED_MATRIX_SIZE bytes of RAM
+#if !defined(OLED_SHADOW_BUFFER)
+#    if defined(__AVR__)
+#        define OLED_SHADOW_BUFFER 0
+#    else
+#        define OLED_SHADOW_BUFFER 1
+#    endif
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
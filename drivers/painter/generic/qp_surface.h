@@ -21,6 +21,22 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty regions tracked for each surface. Each region is transferred to the target
+ *      with its own viewport, so small updates in different areas of the surface don't turn into one large transfer.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_PIXELS
+/**
+ * @def This controls how many unchanged pixels a dirty region may take in when growing to cover a newly changed pixel. If every region
+ *      would need to grow by more than this, a separate region is started instead, as long as one is still available.
+ */
+#    define SURFACE_DIRTY_MERGE_PIXELS 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
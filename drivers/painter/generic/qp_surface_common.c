@@ -29,23 +29,99 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline bool dirty_rect_contains(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b;
+}
+
+static inline bool dirty_rects_overlap(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b;
+}
+
+static inline uint32_t dirty_rect_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+// Number of pixels, other than the one at (x, y), that the region would take in if it grew to cover (x, y)
+static uint32_t dirty_rect_growth(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    uint32_t grown = dirty_rect_area(QP_MIN(rect->l, x), QP_MIN(rect->t, y), QP_MAX(rect->r, x), QP_MAX(rect->b, y));
+    return grown - dirty_rect_area(rect->l, rect->t, rect->r, rect->b) - 1;
+}
+
+static void dirty_rect_grow(surface_dirty_rect_t *rect, const surface_dirty_rect_t *other) {
+    rect->l = QP_MIN(rect->l, other->l);
+    rect->t = QP_MIN(rect->t, other->t);
+    rect->r = QP_MAX(rect->r, other->r);
+    rect->b = QP_MAX(rect->b, other->b);
+}
+
+// Folds any regions overlapping the given one into it, returning its index afterwards
+static uint8_t dirty_merge_overlapping(surface_dirty_data_t *dirty, uint8_t index) {
+    uint8_t i = 0;
+    while (i < dirty->count) {
+        if (i == index || !dirty_rects_overlap(&dirty->rects[index], &dirty->rects[i])) {
+            i++;
+            continue;
+        }
+
+        // Swallow the overlapping region, and move the last region into its slot
+        dirty_rect_grow(&dirty->rects[index], &dirty->rects[i]);
+        dirty->count--;
+        dirty->rects[i] = dirty->rects[dirty->count];
+        if (index == dirty->count) {
+            index = i;
+        }
+
+        // The region has grown, so it may now overlap regions that have already been checked
+        i = 0;
+    }
+    return index;
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+    // Consecutive writes mostly land in the same region
+    if (dirty->count > 0 && dirty_rect_contains(&dirty->rects[dirty->last], x, y)) {
+        return;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+
+    // Find the region that's cheapest to grow, unless one already covers the pixel
+    uint8_t  best        = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        if (dirty_rect_contains(&dirty->rects[i], x, y)) {
+            dirty->last = i;
+            return;
+        }
+        uint32_t growth = dirty_rect_growth(&dirty->rects[i], x, y);
+        if (growth < best_growth) {
+            best        = i;
+            best_growth = growth;
+        }
+    }
+
+    // Start a new region if growing an existing one would transfer too many unchanged pixels
+    if (dirty->count < SURFACE_DIRTY_RECTS && best_growth > SURFACE_DIRTY_MERGE_PIXELS) {
+        dirty->rects[dirty->count] = (surface_dirty_rect_t){.l = x, .t = y, .r = x, .b = y};
+        dirty->last                = dirty->count++;
+        return;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+
+    // Otherwise grow the cheapest region, keeping the regions apart so no pixel is transferred twice
+    dirty_rect_grow(&dirty->rects[best], &(surface_dirty_rect_t){.l = x, .t = y, .r = x, .b = y});
+    dirty->last = dirty_merge_overlapping(dirty, best);
+}
+
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty, bool entire_surface, uint16_t width, uint16_t height) {
+    dirty->last  = 0;
+    dirty->count = entire_surface ? 1 : 0;
+    if (entire_surface) {
+        dirty->rects[0] = (surface_dirty_rect_t){.l = 0, .t = 0, .r = width - 1, .b = height - 1};
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+}
+
+void qp_surface_dirty_bounds(const surface_dirty_data_t *dirty, surface_dirty_rect_t *bounds) {
+    *bounds = dirty->rects[0];
+    for (uint8_t i = 1; i < dirty->count; ++i) {
+        dirty_rect_grow(bounds, &dirty->rects[i]);
     }
 }
 
@@ -57,11 +133,7 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    qp_surface_reset_dirty(&surface->dirty, true, surface->base.panel_width, surface->base.panel_height);
 
     return true;
 }
@@ -80,9 +152,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_reset_dirty(&surface->dirty, false, surface->base.panel_width, surface->base.panel_height);
     return true;
 }
 
@@ -103,7 +173,7 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Drawing routine to copy out the dirty region and send it to another device
+// Drawing routine to copy out the dirty regions and send them to another device
 
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
@@ -111,7 +181,7 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
     // If we're not dirty... we're done.
-    if (!surface_handle->dirty.is_dirty) {
+    if (surface_handle->dirty.count == 0) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
         return true;
     }
@@ -76,7 +76,7 @@ bool qp_ld7032_clear(painter_device_t device) {
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void ld7032_flush_0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer, bool inverted) {
+void ld7032_flush_0(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer, bool inverted) {
     painter_driver_t *                  driver       = (painter_driver_t *)device;
     ld7032_comms_with_command_vtable_t *comms_vtable = (ld7032_comms_with_command_vtable_t *)driver->comms_vtable;
 
@@ -108,7 +108,7 @@ void ld7032_flush_0(painter_device_t device, surface_dirty_data_t *dirty, const
     }
 }
 
-void ld7032_flush_90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer, bool inverted) {
+void ld7032_flush_90(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer, bool inverted) {
     painter_driver_t *                  driver       = (painter_driver_t *)device;
     ld7032_comms_with_command_vtable_t *comms_vtable = (ld7032_comms_with_command_vtable_t *)driver->comms_vtable;
 
@@ -256,23 +256,27 @@ __attribute__((weak)) bool qp_ld7032_init(painter_device_t device, painter_rotat
 bool qp_ld7032_flush(painter_device_t device) {
     ld7032_device_t *driver = (ld7032_device_t *)device;
 
-    if (!driver->oled.surface.dirty.is_dirty) {
+    if (driver->oled.surface.dirty.count == 0) {
         return true;
     }
 
+    // The inverted rotations mirror rows within the area being sent, so the dirty regions are sent as one
+    surface_dirty_rect_t dirty;
+    qp_surface_dirty_bounds(&driver->oled.surface.dirty, &dirty);
+
     switch (driver->oled.base.rotation) {
         default:
         case QP_ROTATION_0:
-            ld7032_flush_0(device, &driver->oled.surface.dirty, driver->framebuffer, false);
+            ld7032_flush_0(device, &dirty, driver->framebuffer, false);
             break;
         case QP_ROTATION_180:
-            ld7032_flush_0(device, &driver->oled.surface.dirty, driver->framebuffer, true);
+            ld7032_flush_0(device, &dirty, driver->framebuffer, true);
             break;
         case QP_ROTATION_90:
-            ld7032_flush_90(device, &driver->oled.surface.dirty, driver->framebuffer, false);
+            ld7032_flush_90(device, &dirty, driver->framebuffer, false);
             break;
         case QP_ROTATION_270:
-            ld7032_flush_90(device, &driver->oled.surface.dirty, driver->framebuffer, true);
+            ld7032_flush_90(device, &dirty, driver->framebuffer, true);
             break;
     }
 
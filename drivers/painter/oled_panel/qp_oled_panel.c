@@ -58,7 +58,7 @@ bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *tar
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void qp_oled_panel_page_column_flush_rect_rot0(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
@@ -91,7 +91,7 @@ void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty
     }
 }
 
-void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void qp_oled_panel_page_column_flush_rect_rot90(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
@@ -125,7 +125,7 @@ void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirt
     }
 }
 
-void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void qp_oled_panel_page_column_flush_rect_rot180(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
@@ -160,7 +160,7 @@ void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dir
     }
 }
 
-void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void qp_oled_panel_page_column_flush_rect_rot270(painter_device_t device, const surface_dirty_rect_t *dirty, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
@@ -193,3 +193,27 @@ void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dir
         qp_comms_send(device, column_data, cols_required);
     }
 }
+
+void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        qp_oled_panel_page_column_flush_rect_rot0(device, &dirty->rects[i], framebuffer);
+    }
+}
+
+void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        qp_oled_panel_page_column_flush_rect_rot90(device, &dirty->rects[i], framebuffer);
+    }
+}
+
+void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        qp_oled_panel_page_column_flush_rect_rot180(device, &dirty->rects[i], framebuffer);
+    }
+}
+
+void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        qp_oled_panel_page_column_flush_rect_rot270(device, &dirty->rects[i], framebuffer);
+    }
+}
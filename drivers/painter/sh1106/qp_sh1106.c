@@ -79,7 +79,7 @@ __attribute__((weak)) bool qp_sh1106_init(painter_device_t device, painter_rotat
 bool qp_sh1106_flush(painter_device_t device) {
     sh1106_device_t *driver = (sh1106_device_t *)device;
 
-    if (!driver->oled.surface.dirty.is_dirty) {
+    if (driver->oled.surface.dirty.count == 0) {
         return true;
     }
 
@@ -251,22 +251,41 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
     pmw33xx_report_t report    = pmw33xx_read_burst(0);
     static bool      in_motion = false;
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+    // Motion beyond the report range, carried over to the next read instead of being clipped
+    static int32_t carry_x = 0;
+    static int32_t carry_y = 0;
+
+    if (report.motion.b.is_lifted || !report.motion.b.is_motion) {
+        report.delta_x = 0;
+        report.delta_y = 0;
+    }
+#endif
 
     if (report.motion.b.is_lifted) {
+#ifndef POINTING_DEVICE_ACCUMULATE_MOTION
         return mouse_report;
-    }
-
-    if (!report.motion.b.is_motion) {
+#endif
+    } else if (!report.motion.b.is_motion) {
         in_motion = false;
+#ifndef POINTING_DEVICE_ACCUMULATE_MOTION
         return mouse_report;
-    }
-
-    if (!in_motion) {
+#endif
+    } else if (!in_motion) {
         in_motion = true;
         pd_dprintf("PWM3360 (0): starting motion\n");
     }
 
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+    int32_t x      = carry_x + report.delta_x;
+    int32_t y      = carry_y + report.delta_y;
+    mouse_report.x = CONSTRAIN_HID_XY(x);
+    mouse_report.y = CONSTRAIN_HID_XY(y);
+    carry_x        = x - mouse_report.x;
+    carry_y        = y - mouse_report.y;
+#else
     mouse_report.x = CONSTRAIN_HID_XY(report.delta_x);
     mouse_report.y = CONSTRAIN_HID_XY(report.delta_y);
+#endif
     return mouse_report;
 }
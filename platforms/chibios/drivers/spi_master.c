@@ -26,6 +26,11 @@ static bool  current_cs_active_low = true;
 
 static SPIConfig spiConfig;
 
+static inline void spi_wait_async(void) {
+    while (!spi_transmit_async_complete()) {
+    }
+}
+
 static inline void spi_select(void) {
     spiSelect(&SPI_DRIVER);
 
@@ -382,6 +387,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 
 spi_status_t spi_write(uint8_t data) {
     uint8_t rxData;
+    spi_wait_async();
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
@@ -389,23 +395,37 @@ spi_status_t spi_write(uint8_t data) {
 
 spi_status_t spi_read(void) {
     uint8_t data = 0;
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_async_complete(void) {
+    return SPI_DRIVER.state != SPI_ACTIVE;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait_async();
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
@@ -94,6 +94,16 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Starts transmitting data in the background, through DMA
+ *
+ * The data must be left untouched until `spi_transmit_async_complete()` returns true. Any other SPI call waits for the transfer
+ * to complete first.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+bool spi_transmit_async_complete(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <string.h>
+#include "i2c_master.h"
+
+static i2c_test_target_t i2c_target;
+static i2c_test_source_t i2c_source;
+static uint32_t          i2c_bytes_written;
+static uint32_t          i2c_transactions;
+
+void i2c_test_attach(i2c_test_target_t target) {
+    i2c_target = target;
+}
+
+void i2c_test_attach_source(i2c_test_source_t source) {
+    i2c_source = source;
+}
+
+uint32_t i2c_test_bytes_written(void) {
+    return i2c_bytes_written;
+}
+
+uint32_t i2c_test_transactions(void) {
+    return i2c_transactions;
+}
+
+void i2c_test_reset_counters(void) {
+    i2c_bytes_written = 0;
+    i2c_transactions  = 0;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_bytes_written += 1 + length;
+    i2c_transactions++;
+    return i2c_target ? i2c_target(address, data, length) : I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_source ? i2c_source(address, data, length) : I2C_STATUS_ERROR;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    // Same as a single write, starting with the register address
+    uint8_t buffer[1 + length];
+    buffer[0] = regaddr;
+    memcpy(&buffer[1], data, length);
+    return i2c_transmit(devaddr, buffer, sizeof(buffer), timeout);
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    uint8_t buffer[2 + length];
+    buffer[0] = regaddr >> 8;
+    buffer[1] = regaddr & 0xFF;
+    memcpy(&buffer[2], data, length);
+    return i2c_transmit(devaddr, buffer, sizeof(buffer), timeout);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    return I2C_STATUS_ERROR;
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    return I2C_STATUS_ERROR;
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    return I2C_STATUS_SUCCESS;
+}
@@ -0,0 +1,44 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+    Stand-in for an I2C bus on the test platform. Writes are handed to the
+    target attached with i2c_test_attach(), as the bytes which would follow
+    the address on the wire, and the bytes sent are counted so tests can
+    measure how much a driver transfers. Reads are handed to the source
+    attached with i2c_test_attach_source(), and fail without one.
+*/
+
+typedef int16_t i2c_status_t;
+
+#define I2C_STATUS_SUCCESS (0)
+#define I2C_STATUS_ERROR (-1)
+#define I2C_STATUS_TIMEOUT (-2)
+
+void         i2c_init(void);
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
+
+typedef i2c_status_t (*i2c_test_target_t)(uint8_t address, const uint8_t* data, uint16_t length);
+
+/* Sends every write to `target`, or acknowledges and drops them if NULL. */
+void i2c_test_attach(i2c_test_target_t target);
+
+typedef i2c_status_t (*i2c_test_source_t)(uint8_t address, uint8_t* data, uint16_t length);
+
+/* Fills every read from `source`, or fails them if NULL. */
+void i2c_test_attach_source(i2c_test_source_t source);
+
+/* Bytes written to the bus since the last reset, including the address byte of each transaction. */
+uint32_t i2c_test_bytes_written(void);
+uint32_t i2c_test_transactions(void);
+void     i2c_test_reset_counters(void);
@@ -0,0 +1,65 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "serial.h"
+#include "serial_test.h"
+
+static split_shared_memory_t serial_slave_shmem;
+static uint32_t              serial_transactions[NUM_TOTAL_TRANSACTIONS];
+static uint32_t              serial_bytes[NUM_TOTAL_TRANSACTIONS];
+
+#define serial_slave_buffer(offset) (((uint8_t *)&serial_slave_shmem) + (offset))
+
+split_shared_memory_t *serial_test_slave_shmem(void) {
+    return &serial_slave_shmem;
+}
+
+uint32_t serial_test_transactions(int8_t transaction_id) {
+    return serial_transactions[transaction_id];
+}
+
+uint32_t serial_test_total_transactions(void) {
+    uint32_t total = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        total += serial_transactions[id];
+    }
+    return total;
+}
+
+uint32_t serial_test_bytes(int8_t transaction_id) {
+    return serial_bytes[transaction_id];
+}
+
+uint32_t serial_test_total_bytes(void) {
+    uint32_t total = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        total += serial_bytes[id];
+    }
+    return total;
+}
+
+void serial_test_reset_counters(void) {
+    memset(serial_transactions, 0, sizeof(serial_transactions));
+    memset(serial_bytes, 0, sizeof(serial_bytes));
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    serial_transactions[sstd_index]++;
+    // Transaction ID and the slave's handshake, then the buffers
+    serial_bytes[sstd_index] += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+
+    memcpy(serial_slave_buffer(trans->initiator2target_offset), split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, serial_slave_buffer(trans->initiator2target_offset), trans->target2initiator_buffer_size, serial_slave_buffer(trans->target2initiator_offset));
+    }
+
+    memcpy(split_trans_target2initiator_buffer(trans), serial_slave_buffer(trans->target2initiator_offset), trans->target2initiator_buffer_size);
+    return true;
+}
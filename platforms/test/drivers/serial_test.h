@@ -0,0 +1,30 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "transport.h"
+
+/*
+    Stand-in for the split serial link on the test platform, with the slave
+    half's shared memory held here. A transaction copies the master's
+    initiator to target buffer into the slave's memory, runs the slave
+    callback of the transaction, and copies the slave's target to initiator
+    buffer back, as the serial drivers do. Transactions are counted by ID,
+    so tests can check which ones the master made, along with the bytes
+    each would put on the wire: the transaction ID, the slave's handshake
+    reply, and both buffers.
+*/
+
+/* The slave half's shared memory, for tests to fill in and inspect as the slave would. */
+split_shared_memory_t* serial_test_slave_shmem(void);
+
+/* Transactions with the given ID since the last reset. */
+uint32_t serial_test_transactions(int8_t transaction_id);
+uint32_t serial_test_total_transactions(void);
+
+/* Bytes sent both ways by transactions with the given ID since the last reset. */
+uint32_t serial_test_bytes(int8_t transaction_id);
+uint32_t serial_test_total_bytes(void);
+void     serial_test_reset_counters(void);
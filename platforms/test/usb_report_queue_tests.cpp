@@ -0,0 +1,283 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "usb_report_queue.h"
+#include "report.h"
+}
+
+/*
+ * Stand-in for a ChibiOS IN endpoint: reports are queued by the main loop,
+ * and the host takes one report off the endpoint every time it polls.
+ */
+class StandInEndpoint {
+   public:
+    StandInEndpoint(uint8_t capacity, uint8_t report_size) : buffer(USB_REPORT_QUEUE_BUFFER_SIZE(capacity, report_size)) {
+        usb_report_queue_init(&queue, buffer.data(), capacity, report_size);
+    }
+
+    bool send(const void *report, uint8_t size, usb_report_merge_t merge, uint8_t type = 0) {
+        usb_report_queue_result_t result = usb_report_queue_push(&queue, (const uint8_t *)report, size, merge, type);
+        start_transmit();
+        return result != USB_REPORT_DROPPED;
+    }
+
+    void host_poll(void) {
+        uint8_t  size;
+        uint8_t *report = usb_report_queue_complete(&queue, &size);
+        if (report != NULL) {
+            received.emplace_back(report, report + size);
+        }
+        start_transmit();
+    }
+
+    usb_report_queue_t                queue;
+    std::vector<std::vector<uint8_t>> received;
+
+   private:
+    void start_transmit(void) {
+        uint8_t size;
+        usb_report_queue_next(&queue, &size);
+    }
+
+    std::vector<uint8_t> buffer;
+};
+
+static report_mouse_t mouse_report(uint8_t buttons, int8_t x, int8_t y) {
+    report_mouse_t report = {};
+    report.buttons        = buttons;
+    report.x              = x;
+    report.y              = y;
+    return report;
+}
+
+static report_keyboard_t keyboard_report(uint8_t mods, uint8_t key) {
+    report_keyboard_t report = {};
+    report.mods              = mods;
+    report.keys[0]           = key;
+    return report;
+}
+
+TEST(UsbReportQueue, ReportsSentInOrder) {
+    StandInEndpoint endpoint(4, sizeof(report_keyboard_t));
+
+    for (uint8_t key = KC_A; key < KC_A + 3; key++) {
+        auto report = keyboard_report(0, key);
+        EXPECT_TRUE(endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_STATE));
+    }
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    ASSERT_EQ(endpoint.received.size(), 3);
+    for (uint8_t i = 0; i < 3; i++) {
+        EXPECT_EQ(((report_keyboard_t *)endpoint.received[i].data())->keys[0], KC_A + i);
+    }
+    EXPECT_EQ(endpoint.queue.stats.queued, 3);
+    EXPECT_EQ(endpoint.queue.stats.merged, 0);
+    EXPECT_EQ(endpoint.queue.stats.dropped, 0);
+}
+
+TEST(UsbReportQueue, KeyboardStateReplacedWhenFull) {
+    StandInEndpoint endpoint(2, sizeof(report_keyboard_t));
+
+    // One report in flight, one pending, further reports replace the pending one
+    auto press   = keyboard_report(0, KC_A);
+    auto shifted = keyboard_report(MOD_BIT(KC_LSFT), KC_A);
+    auto release = keyboard_report(0, KC_NO);
+    EXPECT_TRUE(endpoint.send(&press, sizeof(press), USB_REPORT_MERGE_STATE));
+    EXPECT_TRUE(endpoint.send(&shifted, sizeof(shifted), USB_REPORT_MERGE_STATE));
+    EXPECT_TRUE(endpoint.send(&release, sizeof(release), USB_REPORT_MERGE_STATE));
+    endpoint.host_poll();
+    endpoint.host_poll();
+
+    ASSERT_EQ(endpoint.received.size(), 2);
+    EXPECT_EQ(memcmp(endpoint.received[0].data(), &press, sizeof(press)), 0);
+    EXPECT_EQ(memcmp(endpoint.received[1].data(), &release, sizeof(release)), 0);
+    EXPECT_EQ(endpoint.queue.stats.merged, 1);
+    EXPECT_EQ(endpoint.queue.stats.dropped, 0);
+}
+
+TEST(UsbReportQueue, StateMergeKeepsReportTypesApart) {
+    StandInEndpoint endpoint(3, sizeof(report_extra_t));
+
+    // Reports on a shared endpoint only merge with pending reports of the same report ID
+    report_extra_t system   = {.report_id = REPORT_ID_SYSTEM, .usage = 0x81};
+    report_extra_t consumer = {.report_id = REPORT_ID_CONSUMER, .usage = 0xE9};
+    report_extra_t released = {.report_id = REPORT_ID_CONSUMER, .usage = 0};
+    endpoint.send(&system, sizeof(system), USB_REPORT_MERGE_STATE, system.report_id);
+    endpoint.send(&system, sizeof(system), USB_REPORT_MERGE_STATE, system.report_id);
+    endpoint.send(&consumer, sizeof(consumer), USB_REPORT_MERGE_STATE, consumer.report_id);
+    endpoint.send(&released, sizeof(released), USB_REPORT_MERGE_STATE, released.report_id);
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    ASSERT_EQ(endpoint.received.size(), 3);
+    EXPECT_EQ(memcmp(endpoint.received[1].data(), &system, sizeof(system)), 0);
+    EXPECT_EQ(memcmp(endpoint.received[2].data(), &released, sizeof(released)), 0);
+    EXPECT_EQ(endpoint.queue.stats.merged, 1);
+}
+
+TEST(UsbReportQueue, MouseMotionSummed) {
+    StandInEndpoint endpoint(4, sizeof(report_mouse_t));
+
+    // The first report goes out straight away, the following ones are summed while the host hasn't polled
+    for (int i = 0; i < 10; i++) {
+        auto report = mouse_report(0, 10, -5);
+        EXPECT_TRUE(endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_MOUSE));
+    }
+    endpoint.host_poll();
+    endpoint.host_poll();
+
+    ASSERT_EQ(endpoint.received.size(), 2);
+    auto summed = (report_mouse_t *)endpoint.received[1].data();
+    EXPECT_EQ(summed->x, 90);
+    EXPECT_EQ(summed->y, -45);
+    EXPECT_EQ(endpoint.queue.stats.merged, 8);
+}
+
+TEST(UsbReportQueue, MouseButtonChangesNotMerged) {
+    StandInEndpoint endpoint(4, sizeof(report_mouse_t));
+
+    auto move    = mouse_report(0, 1, 1);
+    auto press   = mouse_report(1, 1, 1);
+    auto release = mouse_report(0, 0, 0);
+    endpoint.send(&move, sizeof(move), USB_REPORT_MERGE_MOUSE);
+    endpoint.send(&move, sizeof(move), USB_REPORT_MERGE_MOUSE);
+    endpoint.send(&press, sizeof(press), USB_REPORT_MERGE_MOUSE);
+    endpoint.send(&release, sizeof(release), USB_REPORT_MERGE_MOUSE);
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    ASSERT_EQ(endpoint.received.size(), 4);
+    EXPECT_EQ(((report_mouse_t *)endpoint.received[2].data())->buttons, 1);
+    EXPECT_EQ(((report_mouse_t *)endpoint.received[3].data())->buttons, 0);
+}
+
+TEST(UsbReportQueue, MouseMotionNotMergedOnOverflow) {
+    StandInEndpoint endpoint(4, sizeof(report_mouse_t));
+
+    auto report = mouse_report(0, 100, 0);
+    for (int i = 0; i < 3; i++) {
+        endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_MOUSE);
+    }
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    // 100 + 100 doesn't fit into a report, so each report is sent on its own
+    ASSERT_EQ(endpoint.received.size(), 3);
+    EXPECT_EQ(endpoint.queue.stats.merged, 0);
+}
+
+TEST(UsbReportQueue, OldestPendingReportDroppedWhenFull) {
+    StandInEndpoint endpoint(2, 4);
+
+    uint8_t reports[3][4] = {{1}, {2}, {3}};
+    for (auto &report : reports) {
+        EXPECT_TRUE(endpoint.send(report, sizeof(report), USB_REPORT_MERGE_NONE));
+    }
+    endpoint.host_poll();
+    endpoint.host_poll();
+
+    // The first report was already in flight, so the second one made way for the third
+    ASSERT_EQ(endpoint.received.size(), 2);
+    EXPECT_EQ(endpoint.received[0][0], 1);
+    EXPECT_EQ(endpoint.received[1][0], 3);
+    EXPECT_EQ(endpoint.queue.stats.dropped, 1);
+}
+
+TEST(UsbReportQueue, LastReportOfTypeNeverDropped) {
+    StandInEndpoint endpoint(2, sizeof(report_extra_t));
+
+    // The consumer release is the only pending consumer report, so the system report can't make room by dropping it
+    report_extra_t consumer = {.report_id = REPORT_ID_CONSUMER, .usage = 0xE9};
+    report_extra_t released = {.report_id = REPORT_ID_CONSUMER, .usage = 0};
+    report_extra_t system   = {.report_id = REPORT_ID_SYSTEM, .usage = 0x81};
+    EXPECT_TRUE(endpoint.send(&consumer, sizeof(consumer), USB_REPORT_MERGE_STATE, consumer.report_id));
+    EXPECT_TRUE(endpoint.send(&released, sizeof(released), USB_REPORT_MERGE_STATE, released.report_id));
+    EXPECT_FALSE(endpoint.send(&system, sizeof(system), USB_REPORT_MERGE_STATE, system.report_id));
+    for (int poll = 0; poll < 3; poll++) {
+        endpoint.host_poll();
+    }
+
+    ASSERT_EQ(endpoint.received.size(), 2);
+    EXPECT_EQ(memcmp(endpoint.received[1].data(), &released, sizeof(released)), 0);
+    EXPECT_EQ(endpoint.queue.stats.dropped, 1);
+}
+
+TEST(UsbReportQueue, SupersededReportDroppedWhenFull) {
+    StandInEndpoint endpoint(3, 4);
+
+    // The oldest pending report is the last of its type, so the one after it makes way instead
+    uint8_t reports[4][4] = {{1}, {2}, {3}, {4}};
+    uint8_t types[4]      = {1, 2, 1, 1};
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(endpoint.send(reports[i], sizeof(reports[i]), USB_REPORT_MERGE_NONE, types[i]));
+    }
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    ASSERT_EQ(endpoint.received.size(), 3);
+    EXPECT_EQ(endpoint.received[0][0], 1);
+    EXPECT_EQ(endpoint.received[1][0], 2);
+    EXPECT_EQ(endpoint.received[2][0], 4);
+    EXPECT_EQ(endpoint.queue.stats.dropped, 1);
+}
+
+TEST(UsbReportQueue, ResetDiscardsPendingReports) {
+    StandInEndpoint endpoint(4, sizeof(report_keyboard_t));
+
+    auto report = keyboard_report(0, KC_A);
+    endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_STATE);
+    endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_STATE);
+    usb_report_queue_reset(&endpoint.queue);
+    EXPECT_TRUE(usb_report_queue_is_empty(&endpoint.queue));
+
+    endpoint.host_poll();
+    EXPECT_TRUE(endpoint.received.empty());
+}
+
+/*
+ * Runs a 1 kHz scan loop sending a mouse report every scan against a host
+ * polling at the given interval, returning the total motion received.
+ */
+static int32_t mouse_motion_received(StandInEndpoint &endpoint, uint32_t scans, uint32_t poll_interval) {
+    for (uint32_t scan = 0; scan < scans; scan++) {
+        auto report = mouse_report(0, 3, 0);
+        endpoint.send(&report, sizeof(report), USB_REPORT_MERGE_MOUSE);
+        if (scan % poll_interval == 0) {
+            endpoint.host_poll();
+        }
+    }
+    for (int poll = 0; poll < 4; poll++) {
+        endpoint.host_poll();
+    }
+
+    int32_t motion = 0;
+    for (auto &report : endpoint.received) {
+        motion += ((report_mouse_t *)report.data())->x;
+    }
+    return motion;
+}
+
+TEST(UsbReportQueue, SlowHostReceivesAllMouseMotion) {
+    StandInEndpoint fast(4, sizeof(report_mouse_t)), slow(4, sizeof(report_mouse_t));
+
+    EXPECT_EQ(mouse_motion_received(fast, 1000, 1), 3000);
+    EXPECT_EQ(mouse_motion_received(slow, 1000, 8), 3000);
+
+    // A host polling every 8 ms gets fewer, larger reports, without the sender ever waiting or losing motion
+    RecordProperty("fast_host_reports", fast.received.size());
+    RecordProperty("slow_host_reports", slow.received.size());
+    RecordProperty("slow_host_merged", slow.queue.stats.merged);
+    EXPECT_EQ(fast.queue.stats.merged, 0);
+    EXPECT_LT(slow.received.size(), 1000 / 8 * 2 + 4);
+    EXPECT_EQ(slow.queue.stats.dropped, 0);
+}
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,20 +317,16 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Layer switch resolve layer
  *
- * Gets the layer based on key info
+ * Walks the active layer stack from the top to find the first layer where key is not transparent
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
-    action_t action;
-    action.code = ACTION_TRANSPARENT;
-
-    layer_state_t layers = layer_state | default_layer_state;
+static uint8_t layer_switch_resolve_layer(keypos_t key, layer_state_t layers) {
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
-            action = action_for_key(i, key);
+            action_t action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
                 return i;
             }
@@ -337,6 +334,54 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE_ENABLE)
+#    ifndef LAYER_RESOLUTION_CACHE_KEYS
+#        define LAYER_RESOLUTION_CACHE_KEYS (MATRIX_ROWS * MATRIX_COLS)
+#    endif
+
+/** \brief resolved layer cache
+ *
+ * Holds the resolved layer + 1 for each key position, zero marks an entry that has not been resolved yet.
+ * Entries are only valid for the combined layer state they were resolved with.
+ */
+static uint8_t       layer_resolution_cache[LAYER_RESOLUTION_CACHE_KEYS] = {0};
+static layer_state_t layer_resolution_cache_state                         = 0;
+
+/** \brief Layer resolution cache clear
+ *
+ * Drops all resolved layers, must be called whenever the keymap contents change
+ */
+void layer_resolution_cache_clear(void) {
+    memset(layer_resolution_cache, 0, sizeof(layer_resolution_cache));
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_RESOLUTION_CACHE_ENABLE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+        if (entry_number < LAYER_RESOLUTION_CACHE_KEYS) {
+            if (layers != layer_resolution_cache_state) {
+                layer_resolution_cache_clear();
+                layer_resolution_cache_state = layers;
+            }
+            if (!layer_resolution_cache[entry_number]) {
+                layer_resolution_cache[entry_number] = layer_switch_resolve_layer(key, layers) + 1;
+            }
+            return layer_resolution_cache[entry_number] - 1;
+        }
+    }
+#    endif
+    return layer_switch_resolve_layer(key, layers);
 #else
     return get_highest_layer(default_layer_state);
 #endif
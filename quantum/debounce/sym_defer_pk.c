@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /*
 Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+A bitmask per row tracks which keys have a running counter, so idle keys are never visited.
 */
 
 #include "debounce.h"
@@ -45,29 +46,28 @@ typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+static matrix_row_t *      debounce_active;
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
 
-#    define DEBOUNCE_ELAPSED 0
-
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+    debounce_active   = (matrix_row_t *)malloc(num_rows * sizeof(matrix_row_t));
     for (uint8_t r = 0; r < num_rows; r++) {
-        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
-            debounce_counters[i++] = DEBOUNCE_ELAPSED;
-        }
+        debounce_active[r] = 0;
     }
 }
 
 void debounce_free(void) {
     free(debounce_counters);
     debounce_counters = NULL;
+    free(debounce_active);
+    debounce_active = NULL;
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -101,40 +101,42 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
-                    matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
-                    cooked_changed |= cooked[row] ^ cooked_next;
-                    cooked[row] = cooked_next;
-                } else {
-                    *debounce_pointer -= elapsed_time;
-                    counters_need_update = true;
-                }
+        debounce_counter_t *row_counters = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        active       = debounce_active[row];
+        matrix_row_t        expired      = 0;
+        while (active) {
+            uint8_t col = matrix_row_first_set_bit(active);
+            active &= active - 1;
+            if (row_counters[col] <= elapsed_time) {
+                expired |= ROW_SHIFTER << col;
+            } else {
+                row_counters[col] -= elapsed_time;
+                counters_need_update = true;
             }
-            debounce_pointer++;
+        }
+        if (expired) {
+            debounce_active[row] &= ~expired;
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
         }
     }
 }
 
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (delta & (ROW_SHIFTER << col)) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
-                }
-            } else {
-                *debounce_pointer = DEBOUNCE_ELAPSED;
-            }
-            debounce_pointer++;
+        // keys that no longer differ stop debouncing, keys that newly differ start a counter
+        matrix_row_t starting = delta & ~debounce_active[row];
+        debounce_active[row]  = delta;
+        if (starting) {
+            counters_need_update = true;
+        }
+        while (starting) {
+            debounce_counters[row * MATRIX_COLS + matrix_row_first_set_bit(starting)] = DEBOUNCE;
+            starting &= starting - 1;
         }
     }
 }
@@ -115,6 +115,25 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     return false;
 }
 
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    uint32_t now   = timer_read32();
+    bool     found = false;
+
+    for (int i = 0; i < table_count; ++i) {
+        deferred_executor_t *entry = &table[i];
+        if (entry->token == INVALID_DEFERRED_TOKEN) {
+            continue;
+        }
+        // Compare relative to now so that timer wraparound doesn't reorder entries
+        if (!found || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) < ((int32_t)TIMER_DIFF_32(*trigger_time, now))) {
+            *trigger_time = entry->trigger_time;
+            found         = true;
+        }
+    }
+
+    return found;
+}
+
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
     uint32_t now = timer_read32();
 
@@ -163,15 +182,49 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
+// Earliest time any basic executor may be due, allowing the task to skip scanning the table until then. This may be
+// earlier than the real next trigger (e.g. after a cancellation), which only costs an extra scan.
+static bool     basic_executors_pending = false;
+static uint32_t basic_next_trigger      = 0;
+
+static inline void basic_next_trigger_update(uint32_t trigger_time) {
+    if (!basic_executors_pending || ((int32_t)TIMER_DIFF_32(trigger_time, basic_next_trigger)) < 0) {
+        basic_next_trigger = trigger_time;
+    }
+    basic_executors_pending = true;
+}
+
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    uint32_t       now   = timer_read32();
+    deferred_token token = defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    if (token != INVALID_DEFERRED_TOKEN) {
+        basic_next_trigger_update(now + delay_ms);
+    }
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    uint32_t now = timer_read32();
+    if (extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms)) {
+        basic_next_trigger_update(now + delay_ms);
+        return true;
+    }
+    return false;
 }
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_trigger(uint32_t *trigger_time) {
+    if (basic_executors_pending) {
+        *trigger_time = basic_next_trigger;
+    }
+    return basic_executors_pending;
+}
 void deferred_exec_task(void) {
+    // Nothing can be due before the earliest known trigger time
+    if (!basic_executors_pending || ((int32_t)TIMER_DIFF_32(basic_next_trigger, timer_read32())) > 0) {
+        return;
+    }
+
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    basic_executors_pending = deferred_exec_advanced_next_trigger(basic_executors, MAX_DEFERRED_EXECUTORS, &basic_next_trigger);
 }
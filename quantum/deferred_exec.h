@@ -60,6 +60,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the time at which the next deferred execution may be due, allowing the main loop to determine how long it can idle.
+ *
+ * @param trigger_time[out] the earliest trigger time -- equivalent time-space as timer_read32(). May be earlier than the actual next execution, never later.
+ * @return true if any deferred execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_next_trigger(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -110,6 +118,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Retrieves the earliest trigger time of all pending deferred executions in a custom table.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the earliest trigger time -- equivalent time-space as timer_read32()
+ * @return true if any deferred execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
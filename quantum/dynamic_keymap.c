@@ -14,6 +14,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
@@ -101,6 +102,51 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+#    define DYNAMIC_KEYMAP_RAM_MIRROR_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#    else
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_ENCODER_SIZE 0
+#    endif
+
+// By default the mirror may use up to a quarter of the RAM on AVR, other platforms have plenty to spare
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_MAX_SIZE
+#        if defined(__AVR__)
+#            include <avr/io.h>
+#            define DYNAMIC_KEYMAP_RAM_MIRROR_MAX_SIZE ((RAMEND - RAMSTART + 1) / 4)
+#        else
+#            define DYNAMIC_KEYMAP_RAM_MIRROR_MAX_SIZE 16384
+#        endif
+#    endif
+
+_Static_assert(DYNAMIC_KEYMAP_RAM_MIRROR_KEYMAP_SIZE + DYNAMIC_KEYMAP_RAM_MIRROR_ENCODER_SIZE <= DYNAMIC_KEYMAP_RAM_MIRROR_MAX_SIZE, "Dynamic keymap RAM mirror is too large, reduce DYNAMIC_KEYMAP_LAYER_COUNT or disable DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE.");
+
+// Copy of the keymap (and encoder map) as stored in EEPROM, big endian, so lookups don't touch EEPROM
+static uint8_t dynamic_keymap_mirror[DYNAMIC_KEYMAP_RAM_MIRROR_KEYMAP_SIZE];
+#    ifdef ENCODER_MAP_ENABLE
+static uint8_t dynamic_keymap_encoder_mirror[DYNAMIC_KEYMAP_RAM_MIRROR_ENCODER_SIZE];
+#    endif
+static bool dynamic_keymap_mirror_loaded = false;
+
+static void dynamic_keymap_mirror_load(void) {
+    if (dynamic_keymap_mirror_loaded) {
+        return;
+    }
+    eeprom_read_block(dynamic_keymap_mirror, (void *)(uintptr_t)DYNAMIC_KEYMAP_EEPROM_ADDR, sizeof(dynamic_keymap_mirror));
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(dynamic_keymap_encoder_mirror, (void *)(uintptr_t)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, sizeof(dynamic_keymap_encoder_mirror));
+#    endif
+    dynamic_keymap_mirror_loaded = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+    dynamic_keymap_mirror_load();
+#endif
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -113,10 +159,16 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+    dynamic_keymap_mirror_load();
+    uint8_t *mirror = &dynamic_keymap_mirror[(uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR];
+    return (mirror[0] << 8) | mirror[1];
+#else
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
@@ -125,6 +177,16 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+    if (dynamic_keymap_mirror_loaded) {
+        uint8_t *mirror = &dynamic_keymap_mirror[(uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR];
+        mirror[0]       = (uint8_t)(keycode >> 8);
+        mirror[1]       = (uint8_t)(keycode & 0xFF);
+    }
+#endif
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE_ENABLE)
+    layer_resolution_cache_clear();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -135,10 +197,16 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+    dynamic_keymap_mirror_load();
+    uint8_t *mirror = &dynamic_keymap_encoder_mirror[(uintptr_t)address - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + (clockwise ? 0 : 2)];
+    return (mirror[0] << 8) | mirror[1];
+#    else
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
@@ -147,6 +215,13 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+    if (dynamic_keymap_mirror_loaded) {
+        uint8_t *mirror = &dynamic_keymap_encoder_mirror[(uintptr_t)address - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + (clockwise ? 0 : 2)];
+        mirror[0]       = (uint8_t)(keycode >> 8);
+        mirror[1]       = (uint8_t)(keycode & 0xFF);
+    }
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -167,32 +242,42 @@ void dynamic_keymap_reset(void) {
     }
 }
 
+// Returns how much of a buffer request falls within the storage area, so that it can be transferred as a single block
+static uint16_t dynamic_keymap_buffer_length(uint16_t offset, uint16_t size, uint16_t limit) {
+    if (offset >= limit) {
+        return 0;
+    }
+    return (size < limit - offset) ? size : (limit - offset);
+}
+
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t length                     = dynamic_keymap_buffer_length(offset, size, dynamic_keymap_eeprom_size);
+    if (length > 0) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+        dynamic_keymap_mirror_load();
+        memcpy(data, &dynamic_keymap_mirror[offset], length);
+#else
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+#endif
     }
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
+    uint16_t length                     = dynamic_keymap_buffer_length(offset, size, dynamic_keymap_eeprom_size);
+    if (length > 0) {
+        eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
+        if (dynamic_keymap_mirror_loaded) {
+            memcpy(&dynamic_keymap_mirror[offset], data, length);
         }
-        source++;
-        target++;
+#endif
     }
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE_ENABLE)
+    layer_resolution_cache_clear();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,37 +305,24 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (length > 0) {
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (length > 0) {
+        eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    uint8_t zeros[32] = {0};
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeros)) {
+        dynamic_keymap_macro_set_buffer(offset, sizeof(zeros), zeros);
     }
 }
 
@@ -104,6 +104,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -143,6 +146,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#include "scan_profiler.h"
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -422,6 +426,9 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
     led_init_ports();
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
@@ -616,101 +623,105 @@ void quantum_task(void) {
 #endif
 
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
+    SCAN_PROFILE(SCAN_PROFILER_MUSIC_TASK, music_task());
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    SCAN_PROFILE(SCAN_PROFILER_KEY_OVERRIDE_TASK, key_override_task());
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    SCAN_PROFILE(SCAN_PROFILER_SEQUENCER_TASK, sequencer_task());
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    SCAN_PROFILE(SCAN_PROFILER_TAP_DANCE_TASK, tap_dance_task());
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    SCAN_PROFILE(SCAN_PROFILER_COMBO_TASK, combo_task());
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    SCAN_PROFILE(SCAN_PROFILER_LEADER_TASK, leader_task());
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    SCAN_PROFILE(SCAN_PROFILER_DECAY_WPM, decay_wpm());
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
+    SCAN_PROFILE(SCAN_PROFILER_DIP_SWITCH_TASK, dip_switch_task());
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    SCAN_PROFILE(SCAN_PROFILER_AUTOSHIFT_MATRIX_SCAN, autoshift_matrix_scan());
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    SCAN_PROFILE(SCAN_PROFILER_CAPS_WORD_TASK, caps_word_task());
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    SCAN_PROFILE(SCAN_PROFILER_SECURE_TASK, secure_task());
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    SCAN_PROFILE(SCAN_PROFILER_LAYER_LOCK_TASK, layer_lock_task());
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+#ifdef SCAN_PROFILER_ENABLE
+    scan_profiler_enter(SCAN_PROFILER_KEYBOARD_TASK);
+#endif
+
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    if (SCAN_PROFILE_RESULT(SCAN_PROFILER_MATRIX_TASK, matrix_task())) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    SCAN_PROFILE(SCAN_PROFILER_QUANTUM_TASK, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    SCAN_PROFILE(SCAN_PROFILER_SPLIT_WATCHDOG_TASK, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    SCAN_PROFILE(SCAN_PROFILER_RGBLIGHT_TASK, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    SCAN_PROFILE(SCAN_PROFILER_LED_MATRIX_TASK, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    SCAN_PROFILE(SCAN_PROFILER_RGB_MATRIX_TASK, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    SCAN_PROFILE(SCAN_PROFILER_BACKLIGHT_TASK, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    if (SCAN_PROFILE_RESULT(SCAN_PROFILER_ENCODER_TASK, encoder_task())) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    if (SCAN_PROFILE_RESULT(SCAN_PROFILER_POINTING_DEVICE_TASK, pointing_device_task())) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    SCAN_PROFILE(SCAN_PROFILER_OLED_TASK, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -718,7 +729,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    SCAN_PROFILE(SCAN_PROFILER_ST7565_TASK, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -727,32 +738,37 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    SCAN_PROFILE(SCAN_PROFILER_MOUSEKEY_TASK, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    SCAN_PROFILE(SCAN_PROFILER_PS2_MOUSE_TASK, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    SCAN_PROFILE(SCAN_PROFILER_MIDI_TASK, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    SCAN_PROFILE(SCAN_PROFILER_JOYSTICK_TASK, joystick_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    SCAN_PROFILE(SCAN_PROFILER_BLUETOOTH_TASK, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    SCAN_PROFILE(SCAN_PROFILER_HAPTIC_TASK, haptic_task());
 #endif
 
-    led_task();
+    SCAN_PROFILE(SCAN_PROFILER_LED_TASK, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    SCAN_PROFILE(SCAN_PROFILER_OS_DETECTION_TASK, os_detection_task());
+#endif
+
+#ifdef SCAN_PROFILER_ENABLE
+    scan_profiler_exit(SCAN_PROFILER_KEYBOARD_TASK);
+    scan_profiler_task();
 #endif
 }
@@ -312,11 +312,39 @@ static void led_task_render(uint8_t effect) {
     }
 }
 
+#ifdef LED_MATRIX_DEBUG_FLUSH_BYTES
+// Bytes of PWM data sent by the driver, and frames flushed, for every effect
+static uint32_t led_matrix_flush_bytes[LED_MATRIX_EFFECT_MAX];
+static uint32_t led_matrix_flush_frames[LED_MATRIX_EFFECT_MAX];
+
+void led_matrix_count_flush_bytes(uint16_t bytes) {
+    if (led_last_effect < LED_MATRIX_EFFECT_MAX) {
+        led_matrix_flush_bytes[led_last_effect] += bytes;
+    }
+}
+
+uint32_t led_matrix_flush_bytes_per_frame(uint8_t mode) {
+    if (mode >= LED_MATRIX_EFFECT_MAX || led_matrix_flush_frames[mode] == 0) {
+        return 0;
+    }
+    return led_matrix_flush_bytes[mode] / led_matrix_flush_frames[mode];
+}
+
+void led_matrix_reset_flush_bytes(void) {
+    memset(led_matrix_flush_bytes, 0, sizeof(led_matrix_flush_bytes));
+    memset(led_matrix_flush_frames, 0, sizeof(led_matrix_flush_frames));
+}
+#endif // LED_MATRIX_DEBUG_FLUSH_BYTES
+
 static void led_task_flush(uint8_t effect) {
     // update last trackers after the first full render so we can init over several frames
     led_last_effect = effect;
     led_last_enable = led_matrix_eeconfig.enable;
 
+#ifdef LED_MATRIX_DEBUG_FLUSH_BYTES
+    led_matrix_flush_frames[effect]++;
+#endif
+
     // update pwm buffers
     led_matrix_update_pwm_buffers();
 
@@ -178,6 +178,13 @@ led_flags_t led_matrix_get_flags(void);
 void        led_matrix_set_flags(led_flags_t flags);
 void        led_matrix_set_flags_noeeprom(led_flags_t flags);
 
+#ifdef LED_MATRIX_DEBUG_FLUSH_BYTES
+/* Called by drivers with the bytes of PWM data they send, which are counted against the effect being flushed. */
+void     led_matrix_count_flush_bytes(uint16_t bytes);
+uint32_t led_matrix_flush_bytes_per_frame(uint8_t mode);
+void     led_matrix_reset_flush_bytes(void);
+#endif
+
 static inline bool led_matrix_check_finished_leds(uint8_t led_idx) {
 #if defined(LED_MATRIX_SPLIT)
     if (is_keyboard_left()) {
@@ -37,6 +37,15 @@ typedef uint32_t matrix_row_t;
 
 #define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
 
+/* index of the lowest set bit of a non-zero matrix row */
+static inline uint8_t matrix_row_first_set_bit(matrix_row_t rowdata) {
+#if (MATRIX_COLS <= 16)
+    return __builtin_ctz(rowdata);
+#else
+    return __builtin_ctzl(rowdata);
+#endif
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
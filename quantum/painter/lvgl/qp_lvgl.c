@@ -3,18 +3,15 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
 
-typedef struct lvgl_state_t {
-    uint8_t        fnc_id; // Ideally this should be the pointer of the function to run
-    uint16_t       delay_ms;
-    deferred_token defer_token;
-} lvgl_state_t;
-
-static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_task_handler
-static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
+static deferred_executor_t lvgl_executor    = {0}; // For lv_tick_inc and lv_task_handler
+static deferred_token      lvgl_defer_token = INVALID_DEFERRED_TOKEN;
+static uint32_t            lvgl_last_run    = 0;
+static bool                lvgl_woken       = false;
 
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
@@ -24,33 +21,39 @@ void *           color_buffer     = NULL;
 
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
-        uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
-        qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
+        painter_driver_t *driver        = (painter_driver_t *)selected_display;
+        uint32_t          number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+        // Stream the area straight to the panel, stopping comms waits for the transfer so LVGL can reuse the buffer
+        if (qp_comms_start(selected_display)) {
+            driver->driver_vtable->viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+            driver->driver_vtable->pixdata(selected_display, (void *)color_p, number_pixels);
+            qp_comms_stop(selected_display);
+        }
+
+        // Panels backed by a framebuffer are only pushed once all of the frame's areas have been rendered
+        if (lv_disp_flush_is_last(disp)) {
+            qp_flush(selected_display);
+        }
         lv_disp_flush_ready(disp);
     }
 }
 
-static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
-    lvgl_state_t *  state     = (lvgl_state_t *)cb_arg;
-    static uint32_t last_tick = 0;
-    switch (state->fnc_id) {
-        case 0: {
-            uint32_t now = timer_read32();
-            lv_tick_inc(TIMER_DIFF_32(now, last_tick));
-            last_tick = now;
-        } break;
-        case 1:
-            lv_task_handler();
-            break;
-
-        default:
-            break;
-    }
+static uint32_t lvgl_task_callback(uint32_t trigger_time, void *cb_arg) {
+    uint32_t now = timer_read32();
+    lv_tick_inc(TIMER_DIFF_32(now, lvgl_last_run));
+    lvgl_last_run = now;
+    lvgl_woken    = false;
 
-    // The tasks should run indefinitely
-    return state->delay_ms;
+    // Come back when LVGL's next timer is due, rather than polling it at a fixed rate
+    uint32_t next_ms = lv_task_handler();
+    if (next_ms < QP_LVGL_TASK_PERIOD) {
+        return QP_LVGL_TASK_PERIOD;
+    }
+    if (next_ms > QP_LVGL_TASK_IDLE_PERIOD) {
+        return QP_LVGL_TASK_IDLE_PERIOD;
+    }
+    return next_ms;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,24 +70,10 @@ bool qp_lvgl_attach(painter_device_t device) {
         return false;
     }
 
-    // Setting up the tasks
-    lvgl_state_t *lv_tick_inc_state = &lvgl_states[0];
-    lv_tick_inc_state->fnc_id       = 0;
-    lv_tick_inc_state->delay_ms     = 1;
-    lv_tick_inc_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, 1, tick_task_callback, lv_tick_inc_state);
-
-    if (lv_tick_inc_state->defer_token == INVALID_DEFERRED_TOKEN) {
-        qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
-        qp_lvgl_detach();
-        return false;
-    }
-
-    lvgl_state_t *lv_task_handler_state = &lvgl_states[1];
-    lv_task_handler_state->fnc_id       = 1;
-    lv_task_handler_state->delay_ms     = QP_LVGL_TASK_PERIOD;
-    lv_task_handler_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, QP_LVGL_TASK_PERIOD, tick_task_callback, lv_task_handler_state);
-
-    if (lv_task_handler_state->defer_token == INVALID_DEFERRED_TOKEN) {
+    // Setting up the task
+    lvgl_woken       = false;
+    lvgl_defer_token = defer_exec_advanced(&lvgl_executor, 1, QP_LVGL_TASK_PERIOD, lvgl_task_callback, NULL);
+    if (lvgl_defer_token == INVALID_DEFERRED_TOKEN) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
         qp_lvgl_detach();
         return false;
@@ -129,9 +118,8 @@ bool qp_lvgl_attach(painter_device_t device) {
 // Quantum Painter LVGL Integration API: qp_lvgl_detach
 
 void qp_lvgl_detach(void) {
-    for (int i = 0; i < 2; ++i) {
-        cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
-    }
+    cancel_deferred_exec_advanced(&lvgl_executor, 1, lvgl_defer_token);
+    lvgl_defer_token = INVALID_DEFERRED_TOKEN;
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
@@ -144,5 +132,14 @@ void qp_lvgl_detach(void) {
 
 void qp_lvgl_internal_tick(void) {
     static uint32_t last_lvgl_exec = 0;
-    deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+
+    // Render areas invalidated since the last run as soon as QP_LVGL_TASK_PERIOD allows, instead of after an idle wait
+    lv_disp_t *disp = lv_disp_get_default();
+    if (!lvgl_woken && lvgl_defer_token != INVALID_DEFERRED_TOKEN && disp && disp->inv_p != 0) {
+        uint32_t elapsed = timer_elapsed32(lvgl_last_run);
+        extend_deferred_exec_advanced(&lvgl_executor, 1, lvgl_defer_token, elapsed < QP_LVGL_TASK_PERIOD ? QP_LVGL_TASK_PERIOD - elapsed : 1);
+        lvgl_woken = true;
+    }
+
+    deferred_exec_advanced_task(&lvgl_executor, 1, &last_lvgl_exec);
 }
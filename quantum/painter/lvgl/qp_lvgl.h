@@ -11,6 +11,11 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+// Longest wait between calls to the LVGL task handler, when none of LVGL's timers are due any sooner
+#ifndef QP_LVGL_TASK_IDLE_PERIOD
+#    define QP_LVGL_TASK_IDLE_PERIOD 100
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
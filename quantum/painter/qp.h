@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+/**
+ * @def This controls whether or not each loaded font keeps a copy of its ASCII glyph table in RAM. Rendering or
+ *      measuring text then only needs a single stream seek per ASCII glyph, instead of seeking and reading the glyph's
+ *      table entry every time. Costs 285 bytes of RAM per font slot (\ref QUANTUM_PAINTER_NUM_FONTS). Defaults to "off".
+ */
+#    define QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -64,6 +73,16 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES
+/**
+ * @def This controls how many frames of each playing animation keep the location of their pixel data, palette and delta
+ *      region in RAM once they've been drawn. Later loops of the animation then skip parsing the frame's descriptors, and
+ *      consecutive frames with identical palettes only load and convert the palette once. Costs 28 bytes of RAM per frame
+ *      per animation slot (\ref QUANTUM_PAINTER_CONCURRENT_ANIMATIONS). Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES 0
+#endif // QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +91,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_COMMS
+/**
+ * @def This controls whether pixel data is transmitted in the background, for comms drivers which support it. The
+ *      pixel data buffer is doubled, so the next block of pixels is decoded while the previous one is still being
+ *      transmitted. Requires an extra \ref QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM. Defaults to "off".
+ */
+#    define QUANTUM_PAINTER_ASYNC_COMMS FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
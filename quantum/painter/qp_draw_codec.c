@@ -126,6 +126,78 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+// Reads the next byte_count bytes of decoded data into the buffer. RLE runs are filled or read from the stream whole, and
+// uncompressed data in one go, instead of a byte at a time through the input callback. Any other input callback is
+// called for each byte.
+static bool qp_internal_read_bytes(qp_internal_byte_input_callback input_callback, void* input_arg, uint8_t* buffer, uint8_t byte_count) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+
+    if (input_callback == qp_drawimage_byte_uncompressed_decoder) {
+        return qp_stream_read(buffer, 1, byte_count, state->src_stream) == byte_count;
+    }
+
+    if (input_callback == qp_drawimage_byte_rle_decoder) {
+        while (byte_count > 0) {
+            // Work out if we're parsing the initial marker byte
+            if (state->rle.mode == MARKER_BYTE) {
+                int16_t c = qp_stream_get(state->src_stream);
+                if (c < 0) {
+                    return false;
+                }
+                if (c >= 128) {
+                    state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                    state->rle.remain = c - 127;
+                } else {
+                    state->rle.mode   = REPEATING_RUN; // repeated run
+                    state->rle.remain = c;
+                }
+
+                state->curr = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    return false;
+                }
+            }
+
+            // Take as much of the run as is needed
+            uint8_t run_bytes = state->rle.remain < byte_count ? state->rle.remain : byte_count;
+            if (run_bytes > 0) {
+                if (state->rle.mode == REPEATING_RUN) {
+                    memset(buffer, state->curr, run_bytes);
+                } else {
+                    // The first byte of what's left of a non-repeating run has already been read
+                    buffer[0] = state->curr;
+                    if (run_bytes > 1 && qp_stream_read(&buffer[1], 1, run_bytes - 1, state->src_stream) != run_bytes - 1) {
+                        return false;
+                    }
+                }
+                buffer += run_bytes;
+                byte_count -= run_bytes;
+                state->rle.remain -= run_bytes;
+            }
+
+            if (state->rle.remain > 0) {
+                // If we're in a non-repeating run, queue up the next byte
+                if (state->rle.mode == NON_REPEATING_RUN) {
+                    state->curr = qp_stream_get(state->src_stream);
+                }
+            } else {
+                // Swap back to querying the marker byte mode
+                state->rle.mode = MARKER_BYTE;
+            }
+        }
+        return true;
+    }
+
+    for (uint8_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = input_callback(input_arg);
+        if (byteval < 0) {
+            return false;
+        }
+        buffer[i] = byteval;
+    }
+    return true;
+}
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -136,7 +208,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_send_pixdata(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
@@ -156,7 +228,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
         painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_send_pixdata(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -165,7 +237,72 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
+// Number of palette indices decoded before they're handed to the driver in a single append_pixels() call
+#ifndef QP_INTERNAL_PALETTE_DECODE_BATCH
+#    define QP_INTERNAL_PALETTE_DECODE_BATCH 32
+#endif
+
+// Equivalent to qp_internal_decode_palette + qp_internal_pixel_appender, but batches the palette indices so the driver
+// converts a run of pixels per call instead of one pixel per call
+static bool qp_internal_decode_palette_to_pixdata(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, uint32_t* pixel_write_pos) {
+    painter_driver_t* driver           = (painter_driver_t*)device;
+    const uint32_t    max_pixels       = qp_internal_num_pixels_in_buffer(device);
+    const uint8_t     pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t     pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t          remaining_pixels = pixel_count;
+    uint32_t          remaining_bytes  = (pixel_count + pixels_per_byte - 1) / pixels_per_byte;
+    uint8_t           indices[QP_INTERNAL_PALETTE_DECODE_BATCH];
+    uint8_t           batch = 0;
+    uint8_t           bytes[QP_INTERNAL_PALETTE_DECODE_BATCH];
+    uint8_t           byte_count = 0;
+    uint8_t           byte_index = 0;
+
+    while (remaining_pixels > 0) {
+        // Read the encoded bytes a chunk at a time
+        if (byte_index == byte_count) {
+            byte_count = remaining_bytes < sizeof(bytes) ? remaining_bytes : sizeof(bytes);
+            byte_index = 0;
+            if (!qp_internal_read_bytes(input_callback, input_arg, bytes, byte_count)) {
+                return false;
+            }
+            remaining_bytes -= byte_count;
+        }
+        uint8_t byteval     = bytes[byte_index++];
+        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
+        for (uint8_t q = 0; q < loop_pixels; ++q) {
+            indices[batch++] = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+
+            // Flush the batch when it's full, or when it reaches the end of the pixdata buffer
+            if (batch == QP_INTERNAL_PALETTE_DECODE_BATCH || *pixel_write_pos + batch == max_pixels) {
+                if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, *pixel_write_pos, batch, indices)) {
+                    return false;
+                }
+                *pixel_write_pos += batch;
+                batch = 0;
+
+                // If we've hit the transmit limit, send out the entire buffer and reset the write position
+                if (*pixel_write_pos == max_pixels) {
+                    if (!qp_internal_send_pixdata(device, *pixel_write_pos)) {
+                        return false;
+                    }
+                    *pixel_write_pos = 0;
+                }
+            }
+        }
+        remaining_pixels -= loop_pixels;
+    }
+
+    if (batch > 0) {
+        if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, *pixel_write_pos, batch, indices)) {
+            return false;
+        }
+        *pixel_write_pos += batch;
+    }
+    return true;
+}
+
+// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette_to_pixdata) or a straight copy of the pixel bytes to send data data to the display based on the asset's native-ness
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
@@ -173,14 +310,13 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
     // Non-native pixel format
     if (bpp <= 8) {
-        // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+        uint32_t pixel_write_pos = 0;
 
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        ret = qp_internal_decode_palette_to_pixdata(device, pixel_count, bpp, input_callback, input_state, &pixel_write_pos);
         // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+        if (ret && pixel_write_pos > 0) {
+            ret &= qp_internal_send_pixdata(device, pixel_write_pos);
         }
     }
 
@@ -192,12 +328,21 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Set up the output state
         qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
 
-        // Stream the raw pixel data to the display
-        uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        // Stream the raw pixel data to the display, reading it a chunk at a time
+        uint32_t remaining_bytes = pixel_count * bpp / 8;
+        uint8_t  bytes[QP_INTERNAL_PALETTE_DECODE_BATCH];
+        ret = true;
+        while (ret && remaining_bytes > 0) {
+            uint8_t byte_count = remaining_bytes < sizeof(bytes) ? remaining_bytes : sizeof(bytes);
+            ret                = qp_internal_read_bytes(input_callback, input_state, bytes, byte_count);
+            for (uint8_t i = 0; ret && i < byte_count; ++i) {
+                ret = qp_internal_byte_appender(bytes[i], &output_state);
+            }
+            remaining_bytes -= byte_count;
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_send_pixdata(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
@@ -20,7 +20,13 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_ASYNC_COMMS
+// With asynchronous comms, one buffer is filled while the other one is being transmitted.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t *                                      qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -33,6 +39,11 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
+// The QGF palette block currently held in the global palette, already converted to the display's native format
+static painter_device_t loaded_palette_device = NULL;
+static qp_stream_t *    loaded_palette_stream = NULL;
+static uint32_t         loaded_palette_offset = 0;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
@@ -41,6 +52,17 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Sends the global native pixel buffer, then swaps to the other buffer with asynchronous comms, so the caller can refill it
+// while the pixels are still being transmitted
+bool qp_internal_send_pixdata(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    bool              ret    = driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0] ? 1 : 0];
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+    return ret;
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -66,8 +88,9 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
 void qp_internal_invalidate_palette(void) {
-    generated_palette = false;
-    generated_steps   = -1;
+    generated_palette     = false;
+    generated_steps       = -1;
+    loaded_palette_stream = NULL;
 }
 
 // Interpolates between two colors to generate a palette
@@ -80,6 +103,7 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     }
 
     // Save the parameters so we know whether we can skip generation
+    loaded_palette_stream  = NULL;
     generated_palette      = true;
     generated_steps        = steps;
     interpolated_fg_hsv888 = fg_hsv888;
@@ -140,6 +164,29 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
     return true;
 }
 
+// Helper for image rendering -- loads the palette block at the supplied offset into the global palette, and converts it to
+// the display's native format. Does nothing if the global palette already holds the same block, converted for the same display.
+bool qp_internal_load_native_qgf_palette(painter_device_t device, qp_stream_t *stream, uint32_t palette_offset, uint8_t bpp) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (loaded_palette_stream == stream && loaded_palette_offset == palette_offset && loaded_palette_device == device) {
+        return true;
+    }
+
+    if (qp_stream_setpos(stream, palette_offset) < 0 || !qp_internal_load_qgf_palette(stream, bpp)) {
+        return false;
+    }
+
+    if (!driver->driver_vtable->palette_convert(device, 1u << bpp, qp_internal_global_pixel_lookup_table)) {
+        qp_dprintf("qp_internal_load_native_qgf_palette: fail (could not convert pixels to native)\n");
+        return false;
+    }
+
+    loaded_palette_device = device;
+    loaded_palette_stream = stream;
+    loaded_palette_offset = palette_offset;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_setpixel
 
@@ -98,6 +98,9 @@ bool qp_close_image(painter_image_handle_t image) {
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
+
+    // The slot's stream may be reused by another image, so a palette loaded from this one can't be kept
+    qp_internal_invalidate_palette();
     return true;
 }
 
@@ -124,14 +127,15 @@ typedef struct qgf_frame_info_t {
     uint16_t              delay;
 } qgf_frame_info_t;
 
-static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
-    painter_driver_t *driver = (painter_driver_t *)device;
+// Where each of a frame's blocks are within the image, along with the info parsed from them
+typedef struct qgf_frame_layout_t {
+    qgf_frame_info_t info;
+    uint32_t         palette_offset; // Start of the palette block, or of an identical one from an earlier frame
+    uint32_t         data_offset;    // Start of the pixel data, 0 if the layout hasn't been read yet
+} qgf_frame_layout_t;
 
-    // Drop out if we can't actually place the data we read out anywhere
-    if (!info) {
-        qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
-        return false;
-    }
+static bool qp_drawimage_read_frame_layout(qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_layout_t *layout) {
+    qgf_frame_info_t *info = &layout->info;
 
     // Seek to the frame
     qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
@@ -148,39 +152,10 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
-    if (!qp_internal_bpp_capable(info->bpp)) {
-        qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Handle palette if needed
-    const uint16_t palette_entries  = 1u << info->bpp;
-    bool           needs_pixconvert = false;
+    // Skip over the palette, it's loaded once the frame is drawn
     if (info->has_palette) {
-        // Load the palette from the stream
-        if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
-            return false;
-        }
-
-        needs_pixconvert = true;
-    } else {
-        if (info->bpp <= 8) {
-            // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-        }
-    }
-
-    if (needs_pixconvert) {
-        // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
-            qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
-            return false;
-        }
+        layout->palette_offset = qp_stream_tell(&qgf_image->stream);
+        qp_stream_seek(&qgf_image->stream, sizeof(qgf_palette_v1_t) + (1u << info->bpp) * sizeof(qgf_palette_entry_v1_t), SEEK_CUR);
     }
 
     // Handle delta if needed
@@ -204,11 +179,93 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Stream is now at the point of being able to read pixdata
+    layout->data_offset = qp_stream_tell(&qgf_image->stream);
+    return true;
+}
+
+// Checks whether two palette blocks of the image have the same entries
+static bool qp_drawimage_palettes_match(qgf_image_handle_t *qgf_image, uint32_t palette_offset_a, uint32_t palette_offset_b, uint8_t bpp) {
+    const uint16_t palette_entries = 1u << bpp;
+    for (uint16_t i = 0; i < palette_entries; ++i) {
+        const uint32_t         entry_offset = sizeof(qgf_palette_v1_t) + i * sizeof(qgf_palette_entry_v1_t);
+        qgf_palette_entry_v1_t entry_a, entry_b;
+        if (qp_stream_setpos(&qgf_image->stream, palette_offset_a + entry_offset) < 0 || qp_stream_read(&entry_a, sizeof(qgf_palette_entry_v1_t), 1, &qgf_image->stream) != 1) {
+            return false;
+        }
+        if (qp_stream_setpos(&qgf_image->stream, palette_offset_b + entry_offset) < 0 || qp_stream_read(&entry_b, sizeof(qgf_palette_entry_v1_t), 1, &qgf_image->stream) != 1) {
+            return false;
+        }
+        if (memcmp(&entry_a, &entry_b, sizeof(qgf_palette_entry_v1_t)) != 0) {
+            return false;
+        }
+    }
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+// Reads the frame's layout, sets up the palette, and leaves the stream at the start of the pixel data. If a frame cache is
+// supplied, frames already in it skip straight to their pixel data, and frames sharing the previous frame's palette are
+// recorded as using the same palette block, so it isn't loaded again.
+static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info, qgf_frame_layout_t *frame_cache, uint16_t frame_cache_size) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Drop out if we can't actually place the data we read out anywhere
+    if (!info) {
+        qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
+        return false;
+    }
+
+    qgf_frame_layout_t  layout = {0};
+    qgf_frame_layout_t *cached = (frame_cache && frame_number < frame_cache_size) ? &frame_cache[frame_number] : NULL;
+    if (cached && cached->data_offset != 0) {
+        layout = *cached;
+    } else {
+        if (!qp_drawimage_read_frame_layout(qgf_image, frame_number, &layout)) {
+            return false;
+        }
+
+        if (cached) {
+            const qgf_frame_layout_t *previous = frame_number > 0 ? &frame_cache[frame_number - 1] : NULL;
+            if (layout.info.has_palette && previous && previous->data_offset != 0 && previous->info.has_palette && previous->info.bpp == layout.info.bpp && qp_drawimage_palettes_match(qgf_image, previous->palette_offset, layout.palette_offset, layout.info.bpp)) {
+                layout.palette_offset = previous->palette_offset;
+            }
+            *cached = layout;
+        }
+    }
+    *info = layout.info;
+
+    if (!qp_internal_bpp_capable(info->bpp)) {
+        qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
+        qp_comms_stop(device);
+        return false;
+    }
+
+    // Handle palette if needed
+    if (info->has_palette) {
+        // Load the palette from the stream, unless it's still loaded from an earlier frame
+        if (!qp_internal_load_native_qgf_palette(device, &qgf_image->stream, layout.palette_offset, info->bpp)) {
+            return false;
+        }
+    } else if (info->bpp <= 8) {
+        // Ensure we aren't reusing any palette
+        qp_internal_invalidate_palette();
+
+        // Interpolate from fg/bg
+        const uint16_t palette_entries = 1u << info->bpp;
+        if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries)) {
+            // Convert the palette to native format
+            if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+                qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
+                qp_comms_stop(device);
+                return false;
+            }
+        }
+    }
+
+    // Stream is now at the point of being able to read pixdata
+    return qp_stream_setpos(&qgf_image->stream, layout.data_offset) >= 0;
+}
+
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_layout_t *frame_cache, uint16_t frame_cache_size) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -223,7 +280,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
 
     // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
+    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info, frame_cache, frame_cache_size)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
         return false;
     }
@@ -275,7 +332,7 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888, NULL, 0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +354,9 @@ typedef struct animation_state_t {
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
     deferred_token         defer_token;
+#if QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
+    qgf_frame_layout_t frame_cache[QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES];
+#endif // QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
 } animation_state_t;
 
 static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
@@ -305,7 +365,11 @@ static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATION
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+#if QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
+    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, state->frame_cache, QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES);
+#else
+    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, NULL, 0);
+#endif // QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
     if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
@@ -353,6 +417,9 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     anim_state->frame_number = 0;
+#if QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
+    memset(anim_state->frame_cache, 0, sizeof(anim_state->frame_cache));
+#endif // QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
 
     // Draw the first frame
     uint16_t delay_ms;
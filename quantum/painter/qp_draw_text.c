@@ -21,6 +21,7 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              glyph_data_offset; // offset of the first glyph's pixel data within the stream
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -32,6 +33,9 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+    qff_ascii_glyph_v1_t ascii_glyphs[95];
+#endif // QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
@@ -106,6 +110,24 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the glyph data starts, so it doesn't need recalculating for every glyph
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                            // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                          // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                            // Skip the data block header
+
+#if QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+    // Keep a copy of the ascii glyph table, so each glyph lookup doesn't need to hit the stream
+    if (font->has_ascii_table) {
+        if (qp_stream_setpos(&font->stream, sizeof(qff_font_descriptor_v1_t) + sizeof(qgf_block_header_v1_t)) < 0 || qp_stream_read(font->ascii_glyphs, sizeof(qff_ascii_glyph_v1_t), 95, &font->stream) != 95) {
+            qp_dprintf("qp_load_font: fail (could not read ascii glyph table)\n");
+            qp_close_font((painter_font_handle_t)font);
+            return NULL;
+        }
+    }
+#endif // QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -218,7 +240,10 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
-        uint32_t             glyph_info_offset = sizeof(qff_font_descriptor_v1_t)          // Skip the font descriptor
+#if QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+        glyph_info = qff_font->ascii_glyphs[code_point - 0x20];
+#else
+        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                      // Skip the font descriptor
                                      + sizeof(qgf_block_header_v1_t)                       // Skip the ascii table header
                                      + (code_point - 0x20) * sizeof(qff_ascii_glyph_v1_t); // Jump direct to the data offset based on the glyph index
         if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
@@ -230,15 +255,11 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             qp_dprintf("Failed to read glyph info\n");
             return false;
         }
+#endif // QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
 
         uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
         uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+        uint32_t data_offset  = qff_font->glyph_data_offset + glyph_offset;
 
         if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
             qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
@@ -268,12 +289,7 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             if (glyph_info.code_point == code_point) {
                 uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
                 uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+                uint32_t data_offset  = qff_font->glyph_data_offset + glyph_offset;
 
                 if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
                     qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
@@ -79,6 +79,67 @@ uint16_t pointing_device_get_shared_cpi(void) {
 static report_mouse_t local_mouse_report         = {};
 static bool           pointing_device_force_send = false;
 
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+#        error POINTING_DEVICE_ACCUMULATE_MOTION is not supported with POINTING_DEVICE_COMBINED
+#    endif
+#    ifndef POINTING_DEVICE_REPORT_INTERVAL_MS
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#        else
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS 1
+#        endif
+#    endif
+
+#    define CONSTRAIN_HID_HV(amt) ((amt) < HV_REPORT_MIN ? HV_REPORT_MIN : ((amt) > HV_REPORT_MAX ? HV_REPORT_MAX : (amt)))
+
+static struct {
+    int32_t  x;
+    int32_t  y;
+    int32_t  h;
+    int32_t  v;
+    uint8_t  buttons;
+    uint32_t last_report;
+} pointing_device_accumulator = {};
+
+/**
+ * @brief Accumulates motion between reports
+ *
+ * Adds the motion of the report to the accumulator, so that the sensor can be read more often than reports are sent. Once per
+ * POINTING_DEVICE_REPORT_INTERVAL_MS, or straight away if the buttons changed, as much of the accumulated motion as fits is moved back
+ * into the report. Anything beyond the report range stays in the accumulator and is sent with the following reports. Called once the
+ * keyboard and user code and mouse keys have had their say, so that the buttons compared are the ones sent.
+ *
+ * @param[in] mouse_report report_mouse_t about to be sent, with its motion replaced by the motion to report
+ * @return true if a report is due
+ */
+static bool pointing_device_accumulate(report_mouse_t *mouse_report) {
+    pointing_device_accumulator.x += mouse_report->x;
+    pointing_device_accumulator.y += mouse_report->y;
+    pointing_device_accumulator.h += mouse_report->h;
+    pointing_device_accumulator.v += mouse_report->v;
+
+    bool report_due = mouse_report->buttons != pointing_device_accumulator.buttons || timer_elapsed32(pointing_device_accumulator.last_report) >= POINTING_DEVICE_REPORT_INTERVAL_MS;
+    if (!report_due) {
+        mouse_report->x = mouse_report->y = mouse_report->h = mouse_report->v = 0;
+        return false;
+    }
+
+    pointing_device_accumulator.buttons     = mouse_report->buttons;
+    pointing_device_accumulator.last_report = timer_read32();
+
+    mouse_report->x = CONSTRAIN_HID_XY(pointing_device_accumulator.x);
+    mouse_report->y = CONSTRAIN_HID_XY(pointing_device_accumulator.y);
+    mouse_report->h = CONSTRAIN_HID_HV(pointing_device_accumulator.h);
+    mouse_report->v = CONSTRAIN_HID_HV(pointing_device_accumulator.v);
+    pointing_device_accumulator.x -= mouse_report->x;
+    pointing_device_accumulator.y -= mouse_report->y;
+    pointing_device_accumulator.h -= mouse_report->h;
+    pointing_device_accumulator.v -= mouse_report->v;
+    return true;
+}
+#endif
+
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
 
@@ -318,6 +379,13 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report.buttons     = local_mouse_report.buttons | mousekey_report.buttons;
 #endif
 
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+    // only report the accumulated motion once per report interval, with the buttons as sent
+    if (!pointing_device_accumulate(&local_mouse_report) && !pointing_device_force_send) {
+        return false;
+    }
+#endif
+
     const bool send_report     = pointing_device_send() || pointing_device_force_send;
     pointing_device_force_send = false;
 
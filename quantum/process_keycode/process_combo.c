@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -102,6 +103,73 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+#    ifndef COMBO_KEYCODE_INDEX_BUCKETS
+#        define COMBO_KEYCODE_INDEX_BUCKETS 32
+#    endif
+#    define COMBO_KEYCODE_INDEX_BUCKET(keycode) ((keycode) % COMBO_KEYCODE_INDEX_BUCKETS)
+
+/* Inverted keycode -> combo lookup. Combos are grouped into buckets by the
+ * keycodes they contain, so a key event only visits the combos listed in its
+ * bucket instead of every combo. Entries in a bucket are kept in ascending
+ * combo index order so processing order matches the linear scan. */
+static uint16_t combo_index_offsets[COMBO_KEYCODE_INDEX_BUCKETS + 1];
+static uint16_t combo_index_entries[COMBO_KEYCODE_INDEX_SIZE];
+static enum { COMBO_INDEX_NOT_BUILT, COMBO_INDEX_READY, COMBO_INDEX_OVERFLOW } combo_index_status = COMBO_INDEX_NOT_BUILT;
+
+/* Whether an earlier key of the combo already put the combo into this bucket. */
+static bool combo_index_bucket_seen(const uint16_t *keys, uint8_t key_index, uint16_t bucket) {
+    for (uint8_t i = 0; i < key_index; i++) {
+        if (COMBO_KEYCODE_INDEX_BUCKET(pgm_read_word(&keys[i])) == bucket) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void build_combo_index(void) {
+    uint16_t cursor[COMBO_KEYCODE_INDEX_BUCKETS];
+
+    // count the combos in every bucket
+    memset(combo_index_offsets, 0, sizeof(combo_index_offsets));
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            uint16_t bucket = COMBO_KEYCODE_INDEX_BUCKET(key);
+            if (!combo_index_bucket_seen(keys, i, bucket)) {
+                combo_index_offsets[bucket + 1]++;
+            }
+        }
+    }
+
+    for (uint16_t bucket = 0; bucket < COMBO_KEYCODE_INDEX_BUCKETS; bucket++) {
+        cursor[bucket] = combo_index_offsets[bucket];
+        combo_index_offsets[bucket + 1] += combo_index_offsets[bucket];
+    }
+
+    if (combo_index_offsets[COMBO_KEYCODE_INDEX_BUCKETS] > COMBO_KEYCODE_INDEX_SIZE) {
+        // not enough room, keep using the linear scan
+        combo_index_status = COMBO_INDEX_OVERFLOW;
+        return;
+    }
+
+    // fill the buckets
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            uint16_t bucket = COMBO_KEYCODE_INDEX_BUCKET(key);
+            if (!combo_index_bucket_seen(keys, i, bucket)) {
+                combo_index_entries[cursor[bucket]++] = idx;
+            }
+        }
+    }
+
+    combo_index_status = COMBO_INDEX_READY;
+}
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -581,10 +649,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+    if (combo_index_status == COMBO_INDEX_NOT_BUILT) {
+        build_combo_index();
+    }
+    if (combo_index_status == COMBO_INDEX_READY) {
+        // only combos sharing a bucket with keycode can contain it
+        uint16_t bucket = COMBO_KEYCODE_INDEX_BUCKET(keycode);
+        for (uint16_t i = combo_index_offsets[bucket]; i < combo_index_offsets[bucket + 1]; ++i) {
+            uint16_t idx = combo_index_entries[i];
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
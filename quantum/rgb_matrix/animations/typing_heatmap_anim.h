@@ -24,6 +24,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+    led_point_t pressed = g_led_config.point[g_led_config.matrix_co[row][col]];
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
@@ -32,9 +33,14 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             if (i_row == row && i_col == col) {
                 g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
+                led_point_t target = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+                int16_t     dx     = (int16_t)target.x - pressed.x;
+                int16_t     dy     = (int16_t)target.y - pressed.y;
+                // keys outside the bounding square can't be within the spread, so skip them before the sqrt
+                if (dx > RGB_MATRIX_TYPING_HEATMAP_SPREAD || dx < -RGB_MATRIX_TYPING_HEATMAP_SPREAD || dy > RGB_MATRIX_TYPING_HEATMAP_SPREAD || dy < -RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                    continue;
+                }
+                uint8_t distance = sqrt16(dx * dx + dy * dy);
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
                     uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
                     if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
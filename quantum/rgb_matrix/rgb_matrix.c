@@ -347,11 +347,39 @@ static void rgb_task_render(uint8_t effect) {
     }
 }
 
+#ifdef RGB_MATRIX_DEBUG_FLUSH_BYTES
+// Bytes of PWM data sent by the driver, and frames flushed, for every effect
+static uint32_t rgb_matrix_flush_bytes[RGB_MATRIX_EFFECT_MAX];
+static uint32_t rgb_matrix_flush_frames[RGB_MATRIX_EFFECT_MAX];
+
+void rgb_matrix_count_flush_bytes(uint16_t bytes) {
+    if (rgb_last_effect < RGB_MATRIX_EFFECT_MAX) {
+        rgb_matrix_flush_bytes[rgb_last_effect] += bytes;
+    }
+}
+
+uint32_t rgb_matrix_flush_bytes_per_frame(uint8_t mode) {
+    if (mode >= RGB_MATRIX_EFFECT_MAX || rgb_matrix_flush_frames[mode] == 0) {
+        return 0;
+    }
+    return rgb_matrix_flush_bytes[mode] / rgb_matrix_flush_frames[mode];
+}
+
+void rgb_matrix_reset_flush_bytes(void) {
+    memset(rgb_matrix_flush_bytes, 0, sizeof(rgb_matrix_flush_bytes));
+    memset(rgb_matrix_flush_frames, 0, sizeof(rgb_matrix_flush_frames));
+}
+#endif // RGB_MATRIX_DEBUG_FLUSH_BYTES
+
 static void rgb_task_flush(uint8_t effect) {
     // update last trackers after the first full render so we can init over several frames
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_DEBUG_FLUSH_BYTES
+    rgb_matrix_flush_frames[effect]++;
+#endif
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -214,6 +214,13 @@ void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
 
+#ifdef RGB_MATRIX_DEBUG_FLUSH_BYTES
+/* Called by drivers with the bytes of PWM data they send, which are counted against the effect being flushed. */
+void     rgb_matrix_count_flush_bytes(uint16_t bytes);
+uint32_t rgb_matrix_flush_bytes_per_frame(uint8_t mode);
+void     rgb_matrix_reset_flush_bytes(void);
+#endif
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
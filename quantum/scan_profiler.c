@@ -0,0 +1,346 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "scan_profiler.h"
+#include "timer.h"
+#include "debug.h"
+#include "util.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include <avr/io.h>
+#    include <util/atomic.h>
+#    include "timer_avr.h"
+#else
+#    include <time.h>
+#endif
+
+#ifndef SCAN_PROFILER_TIMESTAMP
+#    if defined(PROTOCOL_CHIBIOS) && PORT_SUPPORTS_RT == TRUE
+// CPU cycles, from the realtime counter
+#        define SCAN_PROFILER_TIMESTAMP() chSysGetRealtimeCounterX()
+#    elif defined(PROTOCOL_CHIBIOS)
+// Not every ChibiOS port has a realtime counter, e.g. Cortex-M0 parts don't have the cycle counter it is built on,
+// so count ticks of the system timer, at CH_CFG_ST_FREQUENCY
+#        define SCAN_PROFILER_TIMESTAMP() chVTGetSystemTimeX()
+#        define SCAN_PROFILER_TIMESTAMP_TYPE systime_t
+#    elif defined(__AVR__)
+#        define SCAN_PROFILER_TIMESTAMP() scan_profiler_avr_timestamp()
+
+#        if defined(__AVR_ATmega32A__)
+#            define SCAN_PROFILER_TIMER_WRAPPED (TIFR & _BV(OCF0))
+#        elif defined(__AVR_ATtiny85__)
+#            define SCAN_PROFILER_TIMER_WRAPPED (TIFR & _BV(OCF0A))
+#        else
+#            define SCAN_PROFILER_TIMER_WRAPPED (TIFR0 & _BV(OCF0A))
+#        endif
+
+/* Ticks of timer 0, which counts up to TIMER_RAW_TOP every millisecond, so every TIMER_PRESCALER CPU cycles */
+static uint32_t scan_profiler_avr_timestamp(void) {
+    uint32_t ms;
+    uint8_t  raw;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+        // The counter may have wrapped without the interrupt counting the millisecond yet
+        if (SCAN_PROFILER_TIMER_WRAPPED) {
+            ms++;
+            raw = TIMER_RAW;
+        }
+    }
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+}
+#    else
+#        define SCAN_PROFILER_TIMESTAMP() scan_profiler_host_timestamp()
+
+/* Nanoseconds of the host's steady clock on the test platform, as its timer only moves when the tests advance it */
+static uint32_t scan_profiler_host_timestamp(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000 + now.tv_nsec);
+}
+#    endif
+#endif
+
+// The type SCAN_PROFILER_TIMESTAMP() wraps around in, if narrower than 32 bits
+#ifndef SCAN_PROFILER_TIMESTAMP_TYPE
+#    define SCAN_PROFILER_TIMESTAMP_TYPE uint32_t
+#endif
+
+typedef struct {
+    uint32_t start;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t histogram[SCAN_PROFILER_HISTOGRAM_BUCKETS];
+} scan_profiler_task_data_t;
+
+static scan_profiler_task_data_t scan_profiler_data[SCAN_PROFILER_TASK_COUNT];
+
+// clang-format off
+static const char *const scan_profiler_task_names[SCAN_PROFILER_TASK_COUNT] = {
+    [SCAN_PROFILER_KEYBOARD_TASK]         = "keyboard_task",
+    [SCAN_PROFILER_MATRIX_TASK]           = "matrix_task",
+#ifdef SPLIT_KEYBOARD
+    [SCAN_PROFILER_SPLIT_TRANSACTIONS]    = "transactions_master",
+#endif
+    [SCAN_PROFILER_QUANTUM_TASK]          = "quantum_task",
+#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    [SCAN_PROFILER_MUSIC_TASK]            = "music_task",
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    [SCAN_PROFILER_KEY_OVERRIDE_TASK]     = "key_override_task",
+#endif
+#ifdef SEQUENCER_ENABLE
+    [SCAN_PROFILER_SEQUENCER_TASK]        = "sequencer_task",
+#endif
+#ifdef TAP_DANCE_ENABLE
+    [SCAN_PROFILER_TAP_DANCE_TASK]        = "tap_dance_task",
+#endif
+#ifdef COMBO_ENABLE
+    [SCAN_PROFILER_COMBO_TASK]            = "combo_task",
+#endif
+#ifdef LEADER_ENABLE
+    [SCAN_PROFILER_LEADER_TASK]           = "leader_task",
+#endif
+#ifdef WPM_ENABLE
+    [SCAN_PROFILER_DECAY_WPM]             = "decay_wpm",
+#endif
+#ifdef DIP_SWITCH_ENABLE
+    [SCAN_PROFILER_DIP_SWITCH_TASK]       = "dip_switch_task",
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    [SCAN_PROFILER_AUTOSHIFT_MATRIX_SCAN] = "autoshift_matrix_scan",
+#endif
+#ifdef CAPS_WORD_ENABLE
+    [SCAN_PROFILER_CAPS_WORD_TASK]        = "caps_word_task",
+#endif
+#ifdef SECURE_ENABLE
+    [SCAN_PROFILER_SECURE_TASK]           = "secure_task",
+#endif
+#ifdef LAYER_LOCK_ENABLE
+    [SCAN_PROFILER_LAYER_LOCK_TASK]       = "layer_lock_task",
+#endif
+#ifdef SPLIT_WATCHDOG_ENABLE
+    [SCAN_PROFILER_SPLIT_WATCHDOG_TASK]   = "split_watchdog_task",
+#endif
+#ifdef RGBLIGHT_ENABLE
+    [SCAN_PROFILER_RGBLIGHT_TASK]         = "rgblight_task",
+#endif
+#ifdef LED_MATRIX_ENABLE
+    [SCAN_PROFILER_LED_MATRIX_TASK]       = "led_matrix_task",
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    [SCAN_PROFILER_RGB_MATRIX_TASK]       = "rgb_matrix_task",
+#endif
+#ifdef BACKLIGHT_ENABLE
+    [SCAN_PROFILER_BACKLIGHT_TASK]        = "backlight_task",
+#endif
+#ifdef ENCODER_ENABLE
+    [SCAN_PROFILER_ENCODER_TASK]          = "encoder_task",
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+    [SCAN_PROFILER_POINTING_DEVICE_TASK]  = "pointing_device_task",
+#endif
+#ifdef OLED_ENABLE
+    [SCAN_PROFILER_OLED_TASK]             = "oled_task",
+#endif
+#ifdef ST7565_ENABLE
+    [SCAN_PROFILER_ST7565_TASK]           = "st7565_task",
+#endif
+#ifdef MOUSEKEY_ENABLE
+    [SCAN_PROFILER_MOUSEKEY_TASK]         = "mousekey_task",
+#endif
+#ifdef PS2_MOUSE_ENABLE
+    [SCAN_PROFILER_PS2_MOUSE_TASK]        = "ps2_mouse_task",
+#endif
+#ifdef MIDI_ENABLE
+    [SCAN_PROFILER_MIDI_TASK]             = "midi_task",
+#endif
+#ifdef JOYSTICK_ENABLE
+    [SCAN_PROFILER_JOYSTICK_TASK]         = "joystick_task",
+#endif
+#ifdef BLUETOOTH_ENABLE
+    [SCAN_PROFILER_BLUETOOTH_TASK]        = "bluetooth_task",
+#endif
+#ifdef HAPTIC_ENABLE
+    [SCAN_PROFILER_HAPTIC_TASK]           = "haptic_task",
+#endif
+    [SCAN_PROFILER_LED_TASK]              = "led_task",
+#ifdef OS_DETECTION_ENABLE
+    [SCAN_PROFILER_OS_DETECTION_TASK]     = "os_detection_task",
+#endif
+};
+// clang-format on
+
+/* Bucket 0 holds durations of 0, bucket n durations from 2^(n-1) up to 2^n - 1 ticks */
+static uint8_t scan_profiler_bucket(uint32_t duration) {
+    uint8_t bucket = 0;
+    while (duration && bucket < SCAN_PROFILER_HISTOGRAM_BUCKETS - 1) {
+        duration >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void scan_profiler_record(scan_profiler_task_t task, uint32_t duration) {
+    scan_profiler_task_data_t *data = &scan_profiler_data[task];
+
+    if (data->count == 0 || duration < data->min) {
+        data->min = duration;
+    }
+    if (duration > data->max) {
+        data->max = duration;
+    }
+    data->count++;
+    data->total += duration;
+
+    uint8_t bucket = scan_profiler_bucket(duration);
+    if (data->histogram[bucket] == UINT16_MAX) {
+        // Halve every bucket, which keeps the shape of the distribution
+        for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+            data->histogram[i] >>= 1;
+        }
+    }
+    data->histogram[bucket]++;
+}
+
+void scan_profiler_enter(scan_profiler_task_t task) {
+    scan_profiler_data[task].start = SCAN_PROFILER_TIMESTAMP();
+}
+
+void scan_profiler_exit(scan_profiler_task_t task) {
+    scan_profiler_record(task, (SCAN_PROFILER_TIMESTAMP_TYPE)(SCAN_PROFILER_TIMESTAMP() - (SCAN_PROFILER_TIMESTAMP_TYPE)scan_profiler_data[task].start));
+}
+
+bool scan_profiler_exit_result(scan_profiler_task_t task, bool result) {
+    scan_profiler_exit(task);
+    return result;
+}
+
+const char *scan_profiler_task_name(scan_profiler_task_t task) {
+    if (task >= SCAN_PROFILER_TASK_COUNT) {
+        return NULL;
+    }
+    return scan_profiler_task_names[task];
+}
+
+/**
+ * \brief Gets the timing statistics of a task
+ *
+ * The 99th percentile is taken from the histogram, so it is the upper bound of the bucket it falls into, limited to the maximum.
+ *
+ * \return false if the task doesn't exist
+ */
+bool scan_profiler_get_stats(scan_profiler_task_t task, scan_profiler_stats_t *stats) {
+    if (task >= SCAN_PROFILER_TASK_COUNT) {
+        return false;
+    }
+
+    const scan_profiler_task_data_t *data = &scan_profiler_data[task];
+    memset(stats, 0, sizeof(scan_profiler_stats_t));
+    if (data->count == 0) {
+        return true;
+    }
+
+    stats->count = data->count;
+    stats->min   = data->min;
+    stats->max   = data->max;
+    stats->avg   = data->total / data->count;
+
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+        samples += data->histogram[i];
+    }
+    uint32_t rank = (samples * 99 + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+        seen += data->histogram[i];
+        if (seen >= rank) {
+            stats->p99 = i == SCAN_PROFILER_HISTOGRAM_BUCKETS - 1 ? data->max : MIN(data->max, (((uint32_t)1) << i) - 1);
+            break;
+        }
+    }
+    return true;
+}
+
+void scan_profiler_reset(void) {
+    memset(scan_profiler_data, 0, sizeof(scan_profiler_data));
+}
+
+void scan_profiler_print(void) {
+    scan_profiler_stats_t stats;
+    for (uint8_t task = 0; task < SCAN_PROFILER_TASK_COUNT; task++) {
+        scan_profiler_get_stats(task, &stats);
+        dprintf("%-24s n:%lu min:%lu avg:%lu max:%lu p99:%lu\n", scan_profiler_task_names[task], (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.avg, (unsigned long)stats.max, (unsigned long)stats.p99);
+    }
+}
+
+void scan_profiler_task(void) {
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= SCAN_PROFILER_PRINT_INTERVAL_MS) {
+        last_print = timer_read32();
+        scan_profiler_print();
+    }
+}
+
+static void scan_profiler_write_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+bool scan_profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    // data = [ SCAN_PROFILER_RAW_HID_COMMAND, command_id, task, response... ]
+    if (length < 3 + 5 * sizeof(uint32_t) || data[0] != SCAN_PROFILER_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t *command_id = &(data[1]);
+    uint8_t *response   = &(data[3]);
+
+    switch (*command_id) {
+        case id_scan_profiler_get_task_count: {
+            response[0] = SCAN_PROFILER_TASK_COUNT;
+            break;
+        }
+        case id_scan_profiler_get_stats: {
+            scan_profiler_stats_t stats;
+            if (!scan_profiler_get_stats(data[2], &stats)) {
+                *command_id = 0xFF;
+                break;
+            }
+            scan_profiler_write_u32(&response[0], stats.count);
+            scan_profiler_write_u32(&response[4], stats.min);
+            scan_profiler_write_u32(&response[8], stats.avg);
+            scan_profiler_write_u32(&response[12], stats.max);
+            scan_profiler_write_u32(&response[16], stats.p99);
+            break;
+        }
+        case id_scan_profiler_reset: {
+            scan_profiler_reset();
+            break;
+        }
+        case id_scan_profiler_get_task_name: {
+            const char *name = scan_profiler_task_name(data[2]);
+            if (name == NULL) {
+                *command_id = 0xFF;
+                break;
+            }
+            // Truncated to fit the report, leaving room for the terminator
+            uint8_t name_length = MIN(strlen(name), length - 3 - 1);
+            memcpy(response, name, name_length);
+            response[name_length] = '\0';
+            break;
+        }
+        default: {
+            *command_id = 0xFF;
+            break;
+        }
+    }
+    return true;
+}
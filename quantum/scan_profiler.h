@@ -0,0 +1,177 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Records how long each task of the main loop takes, to find out which
+    features are eating into the scan rate.
+
+    Every task run from keyboard_task() and quantum_task() is timed, along
+    with the whole of keyboard_task(). Durations are in ticks of
+    SCAN_PROFILER_TIMESTAMP(): CPU cycles of the realtime counter on ChibiOS
+    ports that have one, ticks of the system timer on other ChibiOS ports,
+    ticks of timer 0 on AVR, and nanoseconds of the host's steady clock on
+    the test platform.
+*/
+
+#ifndef SCAN_PROFILER_PRINT_INTERVAL_MS
+#    define SCAN_PROFILER_PRINT_INTERVAL_MS 10000
+#endif
+
+#ifndef SCAN_PROFILER_RAW_HID_COMMAND
+#    define SCAN_PROFILER_RAW_HID_COMMAND 0xF0
+#endif
+
+// Durations up to 2^(SCAN_PROFILER_HISTOGRAM_BUCKETS - 2) ticks are kept apart, longer ones share the last bucket
+#ifndef SCAN_PROFILER_HISTOGRAM_BUCKETS
+#    define SCAN_PROFILER_HISTOGRAM_BUCKETS 24
+#endif
+
+typedef enum {
+    SCAN_PROFILER_KEYBOARD_TASK,
+    SCAN_PROFILER_MATRIX_TASK,
+#ifdef SPLIT_KEYBOARD
+    SCAN_PROFILER_SPLIT_TRANSACTIONS,
+#endif
+    SCAN_PROFILER_QUANTUM_TASK,
+#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    SCAN_PROFILER_MUSIC_TASK,
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    SCAN_PROFILER_KEY_OVERRIDE_TASK,
+#endif
+#ifdef SEQUENCER_ENABLE
+    SCAN_PROFILER_SEQUENCER_TASK,
+#endif
+#ifdef TAP_DANCE_ENABLE
+    SCAN_PROFILER_TAP_DANCE_TASK,
+#endif
+#ifdef COMBO_ENABLE
+    SCAN_PROFILER_COMBO_TASK,
+#endif
+#ifdef LEADER_ENABLE
+    SCAN_PROFILER_LEADER_TASK,
+#endif
+#ifdef WPM_ENABLE
+    SCAN_PROFILER_DECAY_WPM,
+#endif
+#ifdef DIP_SWITCH_ENABLE
+    SCAN_PROFILER_DIP_SWITCH_TASK,
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    SCAN_PROFILER_AUTOSHIFT_MATRIX_SCAN,
+#endif
+#ifdef CAPS_WORD_ENABLE
+    SCAN_PROFILER_CAPS_WORD_TASK,
+#endif
+#ifdef SECURE_ENABLE
+    SCAN_PROFILER_SECURE_TASK,
+#endif
+#ifdef LAYER_LOCK_ENABLE
+    SCAN_PROFILER_LAYER_LOCK_TASK,
+#endif
+#ifdef SPLIT_WATCHDOG_ENABLE
+    SCAN_PROFILER_SPLIT_WATCHDOG_TASK,
+#endif
+#ifdef RGBLIGHT_ENABLE
+    SCAN_PROFILER_RGBLIGHT_TASK,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    SCAN_PROFILER_LED_MATRIX_TASK,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    SCAN_PROFILER_RGB_MATRIX_TASK,
+#endif
+#ifdef BACKLIGHT_ENABLE
+    SCAN_PROFILER_BACKLIGHT_TASK,
+#endif
+#ifdef ENCODER_ENABLE
+    SCAN_PROFILER_ENCODER_TASK,
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+    SCAN_PROFILER_POINTING_DEVICE_TASK,
+#endif
+#ifdef OLED_ENABLE
+    SCAN_PROFILER_OLED_TASK,
+#endif
+#ifdef ST7565_ENABLE
+    SCAN_PROFILER_ST7565_TASK,
+#endif
+#ifdef MOUSEKEY_ENABLE
+    SCAN_PROFILER_MOUSEKEY_TASK,
+#endif
+#ifdef PS2_MOUSE_ENABLE
+    SCAN_PROFILER_PS2_MOUSE_TASK,
+#endif
+#ifdef MIDI_ENABLE
+    SCAN_PROFILER_MIDI_TASK,
+#endif
+#ifdef JOYSTICK_ENABLE
+    SCAN_PROFILER_JOYSTICK_TASK,
+#endif
+#ifdef BLUETOOTH_ENABLE
+    SCAN_PROFILER_BLUETOOTH_TASK,
+#endif
+#ifdef HAPTIC_ENABLE
+    SCAN_PROFILER_HAPTIC_TASK,
+#endif
+    SCAN_PROFILER_LED_TASK,
+#ifdef OS_DETECTION_ENABLE
+    SCAN_PROFILER_OS_DETECTION_TASK,
+#endif
+    SCAN_PROFILER_TASK_COUNT,
+} scan_profiler_task_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+} scan_profiler_stats_t;
+
+typedef enum {
+    id_scan_profiler_get_task_count = 0x01,
+    id_scan_profiler_get_stats      = 0x02,
+    id_scan_profiler_reset          = 0x03,
+    id_scan_profiler_get_task_name  = 0x04,
+} scan_profiler_command_id_t;
+
+#ifdef SCAN_PROFILER_ENABLE
+#    define SCAN_PROFILE(task, call)   \
+        do {                           \
+            scan_profiler_enter(task); \
+            call;                      \
+            scan_profiler_exit(task);  \
+        } while (0)
+#    define SCAN_PROFILE_RESULT(task, call) scan_profiler_exit_result(task, (scan_profiler_enter(task), (call)))
+#else
+#    define SCAN_PROFILE(task, call) call
+#    define SCAN_PROFILE_RESULT(task, call) (call)
+#endif
+
+void scan_profiler_enter(scan_profiler_task_t task);
+void scan_profiler_exit(scan_profiler_task_t task);
+bool scan_profiler_exit_result(scan_profiler_task_t task, bool result);
+
+const char *scan_profiler_task_name(scan_profiler_task_t task);
+bool        scan_profiler_get_stats(scan_profiler_task_t task, scan_profiler_stats_t *stats);
+void        scan_profiler_reset(void);
+void        scan_profiler_print(void);
+void        scan_profiler_task(void);
+
+/**
+ * \brief Handles scan profiler queries over raw HID
+ *
+ * Request:  [ SCAN_PROFILER_RAW_HID_COMMAND, command_id, task ]
+ * Response: the request, followed by the task count for `id_scan_profiler_get_task_count`, the count, min, avg, max and p99 of
+ *           the task as little endian 32 bit values for `id_scan_profiler_get_stats`, or the NUL terminated name of the task for
+ *           `id_scan_profiler_get_task_name`. Task indices depend on the enabled features, names don't.
+ *
+ * \return true if the request was a scan profiler query, and the response has been written to `data`
+ */
+bool scan_profiler_raw_hid_receive(uint8_t *data, uint8_t length);
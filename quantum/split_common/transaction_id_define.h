@@ -21,7 +21,9 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifndef SPLIT_SLAVE_MATRIX_SINGLE_READ
     GET_SLAVE_MATRIX_CHECKSUM,
+#endif // SPLIT_SLAVE_MATRIX_SINGLE_READ
     GET_SLAVE_MATRIX_DATA,
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -40,7 +42,6 @@ enum serial_transaction_id {
 
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
     PUT_LAYER_STATE,
-    PUT_DEFAULT_LAYER_STATE,
 #endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
 #ifdef SPLIT_LED_STATE_ENABLE
@@ -178,6 +178,26 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_SLAVE_MATRIX_SINGLE_READ
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t       last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    split_slave_matrix_sync_t temp_smatrix;                         // holding area while we test whether or not checksum is correct
+
+    // Fetch the checksum and matrix together, so a change on the slave only costs a single round trip
+    bool okay = transport_read(GET_SLAVE_MATRIX_DATA, &temp_smatrix, sizeof(temp_smatrix));
+    okay &= temp_smatrix.checksum == crc8(temp_smatrix.matrix, sizeof(temp_smatrix.matrix));
+    if (okay) {
+        // Checksum matches the received data, save as the last matrix state
+        memcpy(last_matrix, temp_smatrix.matrix, sizeof(temp_smatrix.matrix));
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+#else // SPLIT_SLAVE_MATRIX_SINGLE_READ
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -193,6 +213,8 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     return okay;
 }
 
+#endif // SPLIT_SLAVE_MATRIX_SINGLE_READ
+
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
@@ -201,9 +223,14 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#ifdef SPLIT_SLAVE_MATRIX_SINGLE_READ
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_DATA] = trans_target2initiator_initializer(smatrix),
+#else // SPLIT_SLAVE_MATRIX_SINGLE_READ
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+#endif // SPLIT_SLAVE_MATRIX_SINGLE_READ
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -336,14 +363,12 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_layer_state_update         = 0;
-    static uint32_t last_default_layer_state_update = 0;
-
-    bool okay = send_if_condition(PUT_LAYER_STATE, &last_layer_state_update, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
-    if (okay) {
-        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &last_default_layer_state_update, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
-    }
-    return okay;
+    static uint32_t     last_update = 0;
+    split_layers_sync_t layers;
+    // Both layer states are sent together, so a change to either only costs a single transaction
+    layers.layer_state         = layer_state;
+    layers.default_layer_state = default_layer_state;
+    return send_if_data_mismatch(PUT_LAYER_STATE, &last_update, &layers, &split_shmem->layers, sizeof(layers));
 }
 
 static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -355,8 +380,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_LAYER_STATE_MASTER() TRANSACTION_HANDLER_MASTER(layer_state)
 #    define TRANSACTIONS_LAYER_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(layer_state)
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS \
-    [PUT_LAYER_STATE]         = trans_initiator2target_initializer(layers.layer_state), \
-    [PUT_DEFAULT_LAYER_STATE] = trans_initiator2target_initializer(layers.default_layer_state),
+    [PUT_LAYER_STATE] = trans_initiator2target_initializer(layers),
 // clang-format on
 
 #else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
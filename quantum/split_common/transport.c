@@ -21,6 +21,7 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "scan_profiler.h"
 
 #ifdef USE_I2C
 
@@ -122,7 +123,7 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    return transactions_master(master_matrix, slave_matrix);
+    return SCAN_PROFILE_RESULT(SCAN_PROFILER_SPLIT_TRANSACTIONS, transactions_master(master_matrix, slave_matrix));
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
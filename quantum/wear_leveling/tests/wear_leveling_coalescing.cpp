@@ -0,0 +1,194 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingCoalescing : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+// Dynamic keymap of 4 layers of 6x16 keys, placed after the other EEPROM config as per a typical keyboard
+static constexpr uint32_t    keymap_address = 0x40;
+static constexpr std::size_t keymap_size    = 4 * 6 * 16 * 2;
+static constexpr std::size_t log_start      = (WEAR_LEVELING_LOGICAL_SIZE + 8) / BACKING_STORE_WRITE_SIZE;
+
+static std::size_t range_entry_writes(std::size_t length) {
+    return (LOG_ENTRY_RANGE_HEADER_BYTES + length + BACKING_STORE_WRITE_SIZE - 1) / BACKING_STORE_WRITE_SIZE;
+}
+
+static std::vector<std::uint8_t> generate_keymap(void) {
+    // Mostly KC_TRNS, with a sprinkling of other keycodes
+    std::mt19937              rng(0x1234);
+    std::vector<std::uint8_t> keymap(keymap_size);
+    for (std::size_t i = 0; i < keymap_size; i += 2) {
+        std::uint16_t keycode = (rng() % 4) ? 0x0001 : (std::uint16_t)(rng() % 0x7FFF);
+        keymap[i + 0]         = (std::uint8_t)(keycode >> 8);
+        keymap[i + 1]         = (std::uint8_t)(keycode & 0xFF);
+    }
+    return keymap;
+}
+
+static void verify_after_reinit(const std::vector<std::uint8_t>& expected) {
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    std::vector<std::uint8_t> readback(expected.size());
+    EXPECT_EQ(wear_leveling_read(keymap_address, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, expected) << "Invalid readback";
+}
+
+struct UploadStats {
+    std::size_t writes;
+    std::size_t log_bytes;
+    std::size_t consolidations;
+};
+
+/**
+ * Uploads the keymap in chunks of the supplied size, returning what it cost in terms of the backing store.
+ */
+static UploadStats upload_keymap(const std::vector<std::uint8_t>& keymap, std::size_t chunk_size, bool batched) {
+    auto& inst = MockBackingStore::Instance();
+    inst.reset_instance();
+    wear_leveling_init();
+
+    if (batched) {
+        wear_leveling_begin_batch();
+    }
+    for (std::size_t offset = 0; offset < keymap.size(); offset += chunk_size) {
+        std::size_t length = std::min(chunk_size, keymap.size() - offset);
+        EXPECT_NE(wear_leveling_write(keymap_address + offset, &keymap[offset], length), WEAR_LEVELING_FAILED) << "Write failed";
+    }
+    if (batched) {
+        EXPECT_NE(wear_leveling_commit_batch(), WEAR_LEVELING_FAILED) << "Commit failed";
+    }
+
+    // Every consolidation rewrites the logical data and its checksum, everything else went to the write log
+    std::size_t consolidations = inst.erase_invoke_count();
+    std::size_t writes         = inst.write_invoke_count();
+    std::size_t log_bytes      = writes * BACKING_STORE_WRITE_SIZE - consolidations * (WEAR_LEVELING_LOGICAL_SIZE + 8);
+    verify_after_reinit(keymap);
+    return {writes, log_bytes, consolidations};
+}
+
+/**
+ * This test verifies that long writes are stored as range entries, and are correctly played back.
+ */
+TEST_F(WearLevelingCoalescing, LongWriteUsesRangeEntry) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::vector<std::uint8_t> testvalue(100);
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(wear_leveling_write(keymap_address, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), range_entry_writes(testvalue.size())) << "Unexpected number of backing store writes";
+
+    write_log_entry_t   entry = {.raw64 = 0};
+    backing_store_int_t value = ~(inst.storage_begin() + log_start)->get(); // the mock stores the complement
+    memcpy(entry.raw8, &value, sizeof(value));
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(entry), LOG_ENTRY_TYPE_RANGE) << "Unexpected log entry type";
+
+    verify_after_reinit(testvalue);
+}
+
+/**
+ * This test verifies that batched single-byte writes are held back until commit, then coalesced into a single range entry.
+ */
+TEST_F(WearLevelingCoalescing, BatchedWritesCoalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::vector<std::uint8_t> testvalue(100);
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+
+    wear_leveling_begin_batch();
+    for (std::size_t i = 0; i < testvalue.size(); ++i) {
+        EXPECT_EQ(wear_leveling_write(keymap_address + i, &testvalue[i], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Batched writes should not reach the backing store before commit";
+
+    std::uint8_t readback;
+    EXPECT_EQ(wear_leveling_read(keymap_address + 5, &readback, 1), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, testvalue[5]) << "Batched writes should be visible to reads before commit";
+
+    EXPECT_EQ(wear_leveling_commit_batch(), WEAR_LEVELING_SUCCESS) << "Commit returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), range_entry_writes(testvalue.size())) << "Unexpected number of backing store writes";
+
+    verify_after_reinit(testvalue);
+}
+
+/**
+ * This test verifies that a batched write far away from the pending span flushes the pending span first.
+ */
+TEST_F(WearLevelingCoalescing, BatchedDisjointWritesFlushed) {
+    std::vector<std::uint8_t> first(32, 0x11), second(32, 0x22);
+
+    wear_leveling_begin_batch();
+    EXPECT_EQ(wear_leveling_write(keymap_address, first.data(), first.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_write(keymap_address + 512, second.data(), second.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(MockBackingStore::Instance().write_invoke_count(), range_entry_writes(first.size())) << "Pending span should have been flushed";
+    EXPECT_EQ(wear_leveling_commit_batch(), WEAR_LEVELING_SUCCESS) << "Commit returned incorrect status";
+
+    verify_after_reinit(first);
+    std::vector<std::uint8_t> readback(second.size());
+    EXPECT_EQ(wear_leveling_read(keymap_address + 512, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, second) << "Invalid readback";
+}
+
+/**
+ * This test verifies that a partially-written range entry is discarded during playback, leaving the data it overwrote intact.
+ */
+TEST_F(WearLevelingCoalescing, TornRangeEntryDiscarded) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::vector<std::uint8_t> prior(100);
+    std::iota(prior.begin(), prior.end(), 0x80);
+    EXPECT_EQ(wear_leveling_write(keymap_address, prior.data(), prior.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    std::vector<std::uint8_t> testvalue(100);
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(wear_leveling_write(keymap_address, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), range_entry_writes(prior.size()) + range_entry_writes(testvalue.size())) << "Unexpected number of backing store writes";
+
+    // Emulate power loss before the last backing store write of the second entry
+    (inst.storage_begin() + log_start + range_entry_writes(prior.size()) + range_entry_writes(testvalue.size()) - 1)->erase();
+
+    // Playback fails verification, so the torn entry is dropped and the prior data consolidated
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Init returned incorrect status";
+    verify_after_reinit(prior);
+}
+
+/**
+ * This test measures the cost of uploading a full dynamic keymap, byte-by-byte as well as in VIA-sized chunks, with and without batching.
+ */
+TEST_F(WearLevelingCoalescing, FullKeymapUpload) {
+    auto keymap = generate_keymap();
+
+    auto bytewise         = upload_keymap(keymap, 1, false);
+    auto bytewise_batched = upload_keymap(keymap, 1, true);
+    auto via_chunks       = upload_keymap(keymap, 28, false);
+    auto whole            = upload_keymap(keymap, keymap.size(), false);
+
+    RecordProperty("bytewise_log_bytes", bytewise.log_bytes);
+    RecordProperty("bytewise_writes", bytewise.writes);
+    RecordProperty("bytewise_consolidations", bytewise.consolidations);
+    RecordProperty("bytewise_batched_log_bytes", bytewise_batched.log_bytes);
+    RecordProperty("bytewise_batched_writes", bytewise_batched.writes);
+    RecordProperty("bytewise_batched_consolidations", bytewise_batched.consolidations);
+    RecordProperty("via_chunks_log_bytes", via_chunks.log_bytes);
+    RecordProperty("via_chunks_writes", via_chunks.writes);
+    RecordProperty("via_chunks_consolidations", via_chunks.consolidations);
+
+    // Batching coalesces the whole upload into range entries, at a small overhead over the raw keymap size
+    EXPECT_EQ(bytewise_batched.consolidations, 0);
+    EXPECT_LE(bytewise_batched.log_bytes, whole.log_bytes);
+    EXPECT_LT(bytewise_batched.log_bytes, keymap_size + keymap_size / 16);
+    EXPECT_LT(bytewise_batched.writes * 2, bytewise.writes);
+    EXPECT_LE(bytewise_batched.consolidations, bytewise.consolidations);
+
+    // VIA-sized chunks are individually large enough to use range entries
+    EXPECT_EQ(via_chunks.consolidations, 0);
+    EXPECT_LT(via_chunks.log_bytes, keymap_size * 3 / 2);
+}
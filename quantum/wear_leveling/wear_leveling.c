@@ -121,6 +121,35 @@
             occur, depending on the length.
         For 8-byte backing store writes, one write operation occur.
 
+    Range log entries:
+
+        Writes of longer contiguous runs are encoded as a range entry, which is
+        a 5-byte header followed directly by the data, zero-padded up to the
+        next backing store write boundary:
+
+        ╔ Range Log Entry (2, 4, 8-byte) ═════════════════════╗
+        ║11000YYY║YYYYYYYY║YYYYYYYY║LLLLLLLL║CCCCCCCC║Value...║
+        ║     └┬┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║        ║
+        ║   Addr ║ Address║ Address║Len - 1 ║Checksum║        ║
+        ╚════════╩════════╩════════╩════════╩════════╩════════╝
+
+        Between 1 and 256 bytes can be included in a single range entry. The
+        checksum is the low byte of the FNV1a_32 of the data -- a range entry
+        that fails verification during playback (such as from a partial write
+        due to power loss) is discarded and forces a consolidation.
+
+        A range entry is only ever appended if it fits entirely within the
+        remaining write log; otherwise the cache is consolidated immediately.
+
+    Write batching:
+
+        Between wear_leveling_begin_batch() and wear_leveling_commit_batch(),
+        writes only update the cache and extend a pending dirty span. Writes
+        that are contiguous with (or close to) the pending span are coalesced
+        into it; any other write flushes the pending span to the write log
+        first. On commit, the pending span is flushed, which for long spans
+        results in range entries rather than one entry per small write.
+
     2-byte backing store optimizations:
 
         For single byte writes, addresses between 0...63 are encoded in a single
@@ -161,9 +190,31 @@
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
+    uint32_t                                                       batch_start;
+    uint32_t                                                       batch_end;
     bool                                                           unlocked;
+    bool                                                           batching;
 } wear_leveling;
 
+/**
+ * Number of bytes available to the write log, after the consolidated data and its FNV1a_64.
+ */
+#define WEAR_LEVELING_LOG_SIZE ((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - 8)
+
+/**
+ * Largest payload of a single range entry -- limited such that one entry never takes up more than a quarter of the write log.
+ */
+#if ((WEAR_LEVELING_LOG_SIZE) / 4 - LOG_ENTRY_RANGE_HEADER_BYTES) < LOG_ENTRY_RANGE_MAX_BYTES
+#    define WEAR_LEVELING_RANGE_CHUNK_BYTES ((WEAR_LEVELING_LOG_SIZE) / 4 - LOG_ENTRY_RANGE_HEADER_BYTES)
+#else
+#    define WEAR_LEVELING_RANGE_CHUNK_BYTES LOG_ENTRY_RANGE_MAX_BYTES
+#endif
+
+/**
+ * Minimum run length for which a range entry is used instead of the smaller entry types.
+ */
+#define WEAR_LEVELING_RANGE_MIN_BYTES 8
+
 /**
  * Locking helper: status
  */
@@ -203,6 +254,8 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.batch_start   = 0;
+    wear_leveling.batch_end     = 0;
 }
 
 /**
@@ -318,6 +371,12 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
 
+    // Any pending batched writes are now part of the consolidated data.
+    if (status != WEAR_LEVELING_FAILED) {
+        wear_leveling.batch_start = 0;
+        wear_leveling.batch_end   = 0;
+    }
+
     return status;
 }
 
@@ -410,6 +469,64 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     return status;
 }
 
+#if WEAR_LEVELING_RANGE_CHUNK_BYTES >= WEAR_LEVELING_RANGE_MIN_BYTES
+/**
+ * Appends the first backing store write's worth of bytes of the staging entry to the write log, shifting the remainder down.
+ */
+static wear_leveling_status_t wear_leveling_append_staged(write_log_entry_t *log, size_t *staged) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    wear_leveling_status_t status = wear_leveling_append_raw(log->raw16[0]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    wear_leveling_status_t status = wear_leveling_append_raw(log->raw32[0]);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    wear_leveling_status_t status = wear_leveling_append_raw(log->raw64);
+#endif
+    memmove(&log->raw8[0], &log->raw8[BACKING_STORE_WRITE_SIZE], sizeof(log->raw8) - (BACKING_STORE_WRITE_SIZE));
+    *staged -= (BACKING_STORE_WRITE_SIZE);
+    return status;
+}
+
+/**
+ * Handles writing range-encoded data to the backing store.
+ * Pre-condition: the cache already contains the data being written.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_write_raw_range(uint32_t address, const void *value, size_t length) {
+    // If the entry doesn't fit in the remainder of the log then it'd be discarded by consolidation anyway, so consolidate straight away.
+    const size_t entry_bytes = ((LOG_ENTRY_RANGE_HEADER_BYTES + length + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE);
+    if (wear_leveling.write_address + entry_bytes >= (WEAR_LEVELING_BACKING_SIZE)) {
+        return wear_leveling_consolidate_force();
+    }
+
+    const uint8_t *   p      = value;
+    const uint8_t     check  = (uint8_t)fnv_32a_buf((void *)p, length, FNV1_32A_INIT);
+    write_log_entry_t log    = LOG_ENTRY_MAKE_RANGE(address, length, check);
+    size_t            staged = LOG_ENTRY_RANGE_HEADER_BYTES;
+
+    // Write to the backing store. See the range log format in the documentation header at the top of the file.
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < length; ++i) {
+        log.raw8[staged++] = p[i];
+        while (staged >= (BACKING_STORE_WRITE_SIZE)) {
+            status = wear_leveling_append_staged(&log, &staged);
+            if (status != WEAR_LEVELING_SUCCESS) {
+                return status;
+            }
+        }
+    }
+
+    // Zero-pad the trailing partial backing store write
+    if (staged > 0) {
+        memset(&log.raw8[staged], 0, (BACKING_STORE_WRITE_SIZE) - staged);
+        staged = BACKING_STORE_WRITE_SIZE;
+        status = wear_leveling_append_staged(&log, &staged);
+    }
+
+    return status;
+}
+#endif // WEAR_LEVELING_RANGE_CHUNK_BYTES >= WEAR_LEVELING_RANGE_MIN_BYTES
+
 /**
  * Handles the actual writing of logical data into the write log section of the backing store.
  */
@@ -418,6 +535,22 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
     while (remaining > 0) {
+#if WEAR_LEVELING_RANGE_CHUNK_BYTES >= WEAR_LEVELING_RANGE_MIN_BYTES
+        // Long runs are written as range entries, using fewer bytes of the log than any of the other encodings:
+        if (remaining >= WEAR_LEVELING_RANGE_MIN_BYTES) {
+            const size_t this_length = remaining >= WEAR_LEVELING_RANGE_CHUNK_BYTES ? WEAR_LEVELING_RANGE_CHUNK_BYTES : remaining;
+            status                   = wear_leveling_write_raw_range(address, p, this_length);
+            if (status != WEAR_LEVELING_SUCCESS) {
+                // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
+                // If a failure occurred, pass it on.
+                return status;
+            }
+            remaining -= this_length;
+            address += (uint32_t)this_length;
+            p += this_length;
+            continue;
+        }
+#endif // WEAR_LEVELING_RANGE_CHUNK_BYTES >= WEAR_LEVELING_RANGE_MIN_BYTES
 #if BACKING_STORE_WRITE_SIZE == 2
         // Small-write optimizations - uint16_t, 0 or 1, address is even, address <16384:
         if (remaining >= 2 && address % 2 == 0 && address < 16384) {
@@ -469,6 +602,43 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Reads the data of a range entry from the write log, either calculating its checksum or applying it to the cache.
+ *
+ * @return false if the backing store could not be read
+ */
+static bool wear_leveling_playback_range(uint32_t entry_address, uint32_t target, size_t length, bool apply, uint8_t *check) {
+    uint32_t            word_address = entry_address + (LOG_ENTRY_RANGE_HEADER_BYTES / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE);
+    size_t              offset       = LOG_ENTRY_RANGE_HEADER_BYTES % (BACKING_STORE_WRITE_SIZE);
+    Fnv32_t             hash         = FNV1_32A_INIT;
+    backing_store_int_t value;
+    if (!backing_store_read(word_address, &value)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+        if (offset == (BACKING_STORE_WRITE_SIZE)) {
+            word_address += (BACKING_STORE_WRITE_SIZE);
+            offset = 0;
+            if (!backing_store_read(word_address, &value)) {
+                return false;
+            }
+        }
+
+        uint8_t b = ((const uint8_t *)&value)[offset++];
+        if (apply) {
+            wear_leveling.cache[target + i] = b;
+        } else {
+            hash = fnv_32a_buf(&b, 1, hash);
+        }
+    }
+
+    if (check) {
+        *check = (uint8_t)hash;
+    }
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -590,6 +760,40 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_RANGE: {
+                const uint32_t entry_address = address - (BACKING_STORE_WRITE_SIZE);
+#if BACKING_STORE_WRITE_SIZE == 2
+                ok = backing_store_read(entry_address + 2, &log.raw16[1]) && backing_store_read(entry_address + 4, &log.raw16[2]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+                ok = backing_store_read(entry_address + 4, &log.raw32[1]);
+#endif
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                const uint32_t a           = LOG_ENTRY_RANGE_GET_ADDRESS(log);
+                const uint16_t l           = LOG_ENTRY_RANGE_GET_LENGTH(log);
+                const uint32_t entry_bytes = ((LOG_ENTRY_RANGE_HEADER_BYTES + l + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE);
+                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE) || entry_address + entry_bytes > (WEAR_LEVELING_BACKING_SIZE)) {
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                // Only apply the data if it's intact -- a partially-written entry is discarded
+                uint8_t check;
+                if (!wear_leveling_playback_range(entry_address, a, l, false, &check) || check != LOG_ENTRY_RANGE_GET_CHECKSUM(log) || !wear_leveling_playback_range(entry_address, a, l, true, NULL)) {
+                    wl_dprintf("Range entry failed verification, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                address = entry_address + entry_bytes;
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -619,6 +823,7 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+    wear_leveling.batching = false;
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -672,25 +877,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
 }
 
 /**
- * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ * Appends already-cached logical data to the write log, unlocking the backing store as required.
  */
-wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
-    wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
-    if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
-        return WEAR_LEVELING_FAILED;
-    }
-
-    wl_dprintf("Write ");
-    wl_dump(address, value, length);
-
-    // Skip write if there's no change compared to the current cached value
-    if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
-        return true;
-    }
-
-    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
-    memcpy(&wear_leveling.cache[address], value, length);
-
+static wear_leveling_status_t wear_leveling_write_log(const uint32_t address, const void *value, size_t length) {
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -726,6 +915,82 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Flushes the pending batched span, if any, to the write log.
+ */
+static wear_leveling_status_t wear_leveling_flush_batch(void) {
+    const uint32_t start = wear_leveling.batch_start;
+    const uint32_t end   = wear_leveling.batch_end;
+    if (start == end) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wear_leveling.batch_start = 0;
+    wear_leveling.batch_end   = 0;
+    return wear_leveling_write_log(start, &wear_leveling.cache[start], end - start);
+}
+
+/**
+ * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ */
+wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
+    wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
+    if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wl_dprintf("Write ");
+    wl_dump(address, value, length);
+
+    // Skip write if there's no change compared to the current cached value
+    if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
+        return true;
+    }
+
+    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
+    memcpy(&wear_leveling.cache[address], value, length);
+
+    if (!wear_leveling.batching) {
+        return wear_leveling_write_log(address, value, length);
+    }
+
+    // Coalesce with the pending span if it's close enough that a separate log entry would cost more than the bytes in between
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    const uint32_t         end    = address + (uint32_t)length;
+    if (wear_leveling.batch_start != wear_leveling.batch_end) {
+        if (address <= wear_leveling.batch_end + LOG_ENTRY_RANGE_HEADER_BYTES && end + LOG_ENTRY_RANGE_HEADER_BYTES >= wear_leveling.batch_start) {
+            wear_leveling.batch_start = address < wear_leveling.batch_start ? address : wear_leveling.batch_start;
+            wear_leveling.batch_end   = end > wear_leveling.batch_end ? end : wear_leveling.batch_end;
+            return status;
+        }
+
+        status = wear_leveling_flush_batch();
+        if (status != WEAR_LEVELING_SUCCESS) {
+            // If consolidation occurred then this write has been consolidated too, so there's nothing left pending.
+            return status;
+        }
+    }
+
+    wear_leveling.batch_start = address;
+    wear_leveling.batch_end   = end;
+    return status;
+}
+
+/**
+ * Starts batching writes.
+ */
+void wear_leveling_begin_batch(void) {
+    wear_leveling.batching = true;
+}
+
+/**
+ * Finishes batching writes, flushing any pending writes to the backing store.
+ */
+wear_leveling_status_t wear_leveling_commit_batch(void) {
+    wear_leveling.batching = false;
+    return wear_leveling_flush_batch();
+}
+
 /**
  * Reads logical data from the cache.
  */
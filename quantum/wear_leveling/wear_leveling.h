@@ -43,6 +43,22 @@ wear_leveling_status_t wear_leveling_erase(void);
  */
 wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value, size_t length);
 
+/**
+ * Starts batching writes.
+ *
+ * Subsequent writes only update the cache, with contiguous writes coalesced together such that they're appended to
+ * the write log as few, larger entries. Pending writes are not persisted until they're flushed, either by a
+ * non-contiguous write or by wear_leveling_commit_batch().
+ */
+void wear_leveling_begin_batch(void);
+
+/**
+ * Finishes batching writes, flushing any pending writes to the backing store.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_commit_batch(void);
+
 /**
  * Reads logical data from the cache.
  *
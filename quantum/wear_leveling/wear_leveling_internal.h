@@ -101,6 +101,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Range storage type: contiguous run of bytes, checksummed
+    LOG_ENTRY_TYPE_RANGE,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +152,21 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_RANGE_HEADER_BYTES 5
+#define LOG_ENTRY_RANGE_MAX_BYTES 256
+#define LOG_ENTRY_RANGE_GET_ADDRESS(entry) LOG_ENTRY_MULTIBYTE_GET_ADDRESS(entry)
+#define LOG_ENTRY_RANGE_GET_LENGTH(entry) (((uint16_t)((entry).raw8[3])) + 1)
+#define LOG_ENTRY_RANGE_GET_CHECKSUM(entry) ((entry).raw8[4])
+#define LOG_ENTRY_MAKE_RANGE(address, length, checksum)                                             \
+    (write_log_entry_t) {                                                                           \
+        .raw8 = {                                                                                   \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_RANGE) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */    \
+                   | ((((uint8_t)((address) >> 16))) & BITMASK_FOR_BITCOUNT(3))       /* address */ \
+                   ),                                                                               \
+            [1] = (((uint8_t)((address) >> 8)) & BITMASK_FOR_BITCOUNT(8)), /* address */            \
+            [2] = (((uint8_t)(address)) & BITMASK_FOR_BITCOUNT(8)),        /* address */            \
+            [3] = ((uint8_t)((length) - 1)),                               /* length */             \
+            [4] = ((uint8_t)(checksum)),                                   /* checksum */           \
+        }                                                                                           \
+    }
@@ -76,6 +76,39 @@ TEST_F(KeyPress, CorrectKeysAreReportedWhenTwoKeysArePressed) {
     keyboard_task();
 }
 
+TEST_F(KeyPress, KeysChangedInTheSameScanAreReportedInColumnOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 1, 2, KC_A);
+    auto       key_b = KeymapKey(0, 4, 2, KC_B);
+    auto       key_c = KeymapKey(0, 9, 2, KC_C);
+    auto       key_d = KeymapKey(0, 0, 3, KC_D);
+
+    set_keymap({key_a, key_b, key_c, key_d});
+
+    key_d.press();
+    key_c.press();
+    key_a.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code));
+    keyboard_task();
+
+    key_c.release();
+    key_b.release();
+    EXPECT_REPORT(driver, (key_a.report_code, key_c.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_d.report_code));
+    keyboard_task();
+
+    key_a.release();
+    key_d.release();
+    EXPECT_REPORT(driver, (key_d.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+}
+
 TEST_F(KeyPress, LeftShiftIsReportedCorrectly) {
     TestDriver driver;
     auto       key_a    = KeymapKey(0, 0, 0, KC_A);
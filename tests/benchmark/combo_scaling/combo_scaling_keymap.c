@@ -0,0 +1,44 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "combo_scaling_keymap.h"
+
+/*
+ * 500 two key combos over the 40 keycodes of the letters, digits, enter,
+ * escape, backspace and tab. Combo n joins key n % 40 with the key
+ * 1 + n / 40 places after it, so each keycode is part of 25 combos and no
+ * two combos have the same keys.
+ */
+static const uint16_t combo_scaling_keycodes[COMBO_SCALING_KEYCODES] = {
+    KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J,
+    KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T,
+    KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z, KC_1, KC_2, KC_3, KC_4,
+    KC_5, KC_6, KC_7, KC_8, KC_9, KC_0, KC_ENT, KC_ESC, KC_BSPC, KC_TAB,
+};
+
+_Static_assert(COMBO_SCALING_COMBOS / COMBO_SCALING_KEYCODES < COMBO_SCALING_KEYCODES / 2, "Combos have distinct keys");
+
+uint16_t combo_scaling_keycode(uint8_t key) {
+    return combo_scaling_keycodes[key];
+}
+
+void combo_scaling_combo_keys(uint16_t combo, uint8_t *first, uint8_t *second) {
+    *first  = combo % COMBO_SCALING_KEYCODES;
+    *second = (*first + 1 + combo / COMBO_SCALING_KEYCODES) % COMBO_SCALING_KEYCODES;
+}
+
+static uint16_t combo_scaling_keys[COMBO_SCALING_COMBOS][3];
+
+combo_t key_combos[COMBO_SCALING_COMBOS];
+
+void combo_scaling_init(void) {
+    for (uint16_t combo = 0; combo < COMBO_SCALING_COMBOS; combo++) {
+        uint8_t first, second;
+        combo_scaling_combo_keys(combo, &first, &second);
+        combo_scaling_keys[combo][0] = combo_scaling_keycodes[first];
+        combo_scaling_keys[combo][1] = combo_scaling_keycodes[second];
+        combo_scaling_keys[combo][2] = COMBO_END;
+        key_combos[combo]            = (combo_t)COMBO(combo_scaling_keys[combo], KC_F1);
+    }
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#define COMBO_SCALING_COMBOS 500
+#define COMBO_SCALING_KEYCODES 40
+
+/* The keycode on each of the 40 keys of the test matrix, row by row. */
+uint16_t combo_scaling_keycode(uint8_t key);
+
+/* The keys of the given combo, as indices into the keys of the test matrix. */
+void combo_scaling_combo_keys(uint16_t combo, uint8_t *first, uint8_t *second);
+
+/* Fills in the combos, before any key is processed. */
+void combo_scaling_init(void);
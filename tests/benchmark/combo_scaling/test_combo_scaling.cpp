@@ -0,0 +1,106 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "combo_scaling_keymap.h"
+}
+
+/*
+ * Typing on a keymap with 500 two key combos, 25 of them on every key, the
+ * way a steno-like layout of chords would be set up.
+ *
+ * The combo_scaling_index benchmark builds the same test with
+ * COMBO_KEYCODE_INDEX_SIZE defined, so comparing the two reports shows what
+ * the keycode index saves over checking every combo on every key event.
+ *
+ * As part of `make test`, each workload runs a few times as a smoke test.
+ * `make benchmark:combo_scaling` runs them QMK_BENCHMARK_ITERATIONS times,
+ * and records the time per key event as properties of the JSON test report.
+ */
+class ComboScaling : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        combo_scaling_init();
+        for (uint8_t key = 0; key < COMBO_SCALING_KEYCODES; key++) {
+            keys.emplace_back(0, key % MATRIX_COLS, key / MATRIX_COLS, combo_scaling_keycode(key));
+        }
+        for (auto &key : keys) {
+            add_key(key);
+        }
+
+        // Reports with the combos' keycode pressed
+        driver.on_keyboard_report = [this](const report_keyboard_t &report) {
+            for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+                combo_reports += report.keys[i] == KC_F1;
+            }
+        };
+    }
+
+    void press(KeymapKey &key) {
+        key.press();
+        run_one_scan_loop();
+        key_events++;
+    }
+
+    void release(KeymapKey &key) {
+        key.release();
+        run_one_scan_loop();
+        key_events++;
+    }
+
+    template <typename Workload>
+    void run(Workload workload) {
+        uint64_t elapsed = time_iterations(workload);
+
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+        record("lookup", "keycode_index");
+#else
+        record("lookup", "linear");
+#endif
+        record("combos", COMBO_SCALING_COMBOS);
+        record("key_events", key_events);
+        record("reports", driver.keyboard_reports);
+        record("ns_per_key_event", per(elapsed, key_events));
+    }
+
+    BenchmarkDriver        driver;
+    std::vector<KeymapKey> keys;
+    uint64_t               key_events    = 0;
+    uint64_t               combo_reports = 0;
+};
+
+TEST_F(ComboScaling, Typing) {
+    // One key at a time, so every key is sent as itself
+    run([&] {
+        for (auto &key : keys) {
+            press(key);
+            release(key);
+        }
+    });
+
+    EXPECT_EQ(driver.keyboard_reports, key_events);
+    EXPECT_EQ(combo_reports, 0);
+}
+
+TEST_F(ComboScaling, Chords) {
+    // Every 25th combo, spread over all the keys
+    run([&] {
+        for (uint16_t combo = 0; combo < COMBO_SCALING_COMBOS; combo += 25) {
+            uint8_t first, second;
+            combo_scaling_combo_keys(combo, &first, &second);
+            press(keys[first]);
+            press(keys[second]);
+            release(keys[first]);
+            release(keys[second]);
+        }
+    });
+
+    // Every chord is its combo's keycode
+    EXPECT_EQ(combo_reports, iterations * COMBO_SCALING_COMBOS / 25);
+}
@@ -0,0 +1,11 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The combo_scaling benchmark, with the combo keycode index enabled
+COMBO_ENABLE = yes
+
+VPATH += tests/benchmark/combo_scaling
+
+INTROSPECTION_KEYMAP_C = combo_scaling_keymap.c
+
+SRC += tests/benchmark/combo_scaling/test_combo_scaling.cpp
@@ -0,0 +1,112 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "debounce.h"
+
+void advance_time(uint32_t ms);
+}
+
+typedef std::array<matrix_row_t, MATRIX_ROWS> raw_matrix_t;
+
+/* Scans between key presses, and how long each key is held for. */
+#define PRESS_INTERVAL 8
+#define HOLD_SCANS 40
+
+/*
+ * Debounces a matrix scanned once a millisecond, while idle and while
+ * typing, with every key bouncing for a couple of scans as it is pressed
+ * and released.
+ *
+ * The benchmark builds the sym_defer_pk debouncer for the 4x10 matrix of
+ * the test platform, and the debounce_eager benchmark the same test with
+ * sym_eager_pk. The benchmarks named after them with a matrix size, from
+ * 8x8 to 32x32, sweep the size of the matrix.
+ *
+ * As part of `make test`, each workload runs a few times as a smoke test.
+ * `make benchmark:debounce` runs them QMK_BENCHMARK_ITERATIONS times, and
+ * records the time per debounce() call as properties of the JSON test report.
+ */
+class Debounce : public BenchmarkFixture {
+   public:
+    /* The test matrix doesn't debounce, so the debouncer is set up once for all the tests, and only freed after the last one. */
+    static void SetUpTestCase() {
+        TestFixture::SetUpTestCase();
+        debounce_init(MATRIX_ROWS);
+    }
+
+    static void TearDownTestCase() {
+        debounce_free();
+        TestFixture::TearDownTestCase();
+    }
+
+   protected:
+    /* Typing across every key in turn, each one held while the next few are pressed. */
+    static std::vector<raw_matrix_t> typing_scans(void) {
+        const uint16_t            keys  = MATRIX_ROWS * MATRIX_COLS;
+        uint32_t                  scans = keys * PRESS_INTERVAL + HOLD_SCANS + 2 * DEBOUNCE;
+        std::vector<raw_matrix_t> raw(scans, raw_matrix_t{});
+        for (uint16_t key = 0; key < keys; key++) {
+            matrix_row_t bit   = (matrix_row_t)1 << (key % MATRIX_COLS);
+            uint32_t     press = key * PRESS_INTERVAL;
+            for (uint32_t scan = press; scan < press + HOLD_SCANS; scan++) {
+                // Bouncing for the first and last couple of scans
+                uint32_t since = scan - press;
+                if (since == 1 || since == HOLD_SCANS - 2) {
+                    continue;
+                }
+                raw[scan][key / MATRIX_COLS] |= bit;
+            }
+        }
+        return raw;
+    }
+
+    /* Runs the scans through debounce(), returning the time taken and counting the changes to the cooked matrix. */
+    uint64_t run(const std::vector<raw_matrix_t> &scans, uint32_t *cooked_changes) {
+        raw_matrix_t raw    = {};
+        raw_matrix_t cooked = {};
+        *cooked_changes     = 0;
+
+        uint64_t elapsed = time_iterations([&] {
+            for (const raw_matrix_t &next : scans) {
+                bool changed = raw != next;
+                raw          = next;
+                advance_time(1);
+                *cooked_changes += debounce(raw.data(), cooked.data(), MATRIX_ROWS, changed);
+            }
+        });
+
+        // Settled on the last scan
+        EXPECT_TRUE(cooked == raw);
+        return per(elapsed, iterations * scans.size());
+    }
+
+    void record_scan_time(uint64_t ns) {
+        record("debounce_type", DEBOUNCE_BENCHMARK_TYPE);
+        record("matrix", (std::to_string(MATRIX_ROWS) + "x" + std::to_string(MATRIX_COLS)).c_str());
+        record("ns_per_scan", ns);
+    }
+};
+
+TEST_F(Debounce, Idle) {
+    std::vector<raw_matrix_t> scans(100, raw_matrix_t{});
+    uint32_t                  cooked_changes;
+    record_scan_time(run(scans, &cooked_changes));
+    EXPECT_EQ(cooked_changes, 0);
+}
+
+TEST_F(Debounce, Typing) {
+    std::vector<raw_matrix_t> scans = typing_scans();
+    uint32_t                  cooked_changes;
+    record_scan_time(run(scans, &cooked_changes));
+
+    // Each press and release is seen once, however much it bounces, although some land in the same scan
+    EXPECT_GE(cooked_changes, iterations * MATRIX_ROWS * MATRIX_COLS);
+    EXPECT_LE(cooked_changes, iterations * MATRIX_ROWS * MATRIX_COLS * 2);
+}
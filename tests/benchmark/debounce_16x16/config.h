@@ -0,0 +1,16 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#undef MATRIX_ROWS
+#define MATRIX_ROWS 16
+#undef MATRIX_COLS
+#define MATRIX_COLS 16
+
+#define DEBOUNCE 5
+
+// Matches DEBOUNCE_TYPE in test.mk, for the report
+#define DEBOUNCE_BENCHMARK_TYPE "sym_defer_pk"
@@ -0,0 +1,11 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DEBOUNCE 5
+
+// Matches DEBOUNCE_TYPE in test.mk, for the report
+#define DEBOUNCE_BENCHMARK_TYPE "sym_eager_pk"
@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The debounce benchmark, with the eager per-key algorithm on a 8x8 matrix
+DEBOUNCE_TYPE = sym_eager_pk
+
+SRC += tests/benchmark/debounce/test_debounce.cpp
@@ -0,0 +1,98 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "test_matrix.h"
+}
+
+/* Key events reaching the keymap, counted so the tests can check none were missed. */
+static uint64_t key_events = 0;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    key_events++;
+    return true;
+}
+
+/*
+ * Scans the test matrix through keyboard_task() while idle, with one key
+ * changing per scan, and with every key changing in the same scan, on a
+ * keymap of KC_NO so that little beyond the matrix handling is part of the
+ * time measured.
+ *
+ * As part of `make test`, each workload runs a few times as a smoke test.
+ * `make benchmark:matrix_task` runs them QMK_BENCHMARK_ITERATIONS times, and
+ * records the time per scan as properties of the JSON test report.
+ */
+class MatrixTask : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        key_events = 0;
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, KC_NO));
+            }
+        }
+    }
+
+    void scan(void) {
+        run_one_scan_loop();
+        scans++;
+    }
+
+    template <typename Workload>
+    void run(Workload workload) {
+        uint64_t elapsed = time_iterations(workload);
+
+        record("scans", scans);
+        record("key_events", key_events);
+        record("ns_per_scan", per(elapsed, scans));
+    }
+
+    BenchmarkDriver driver;
+    uint64_t        scans = 0;
+};
+
+TEST_F(MatrixTask, Idle) {
+    run([&] {
+        for (uint8_t i = 0; i < MATRIX_ROWS * MATRIX_COLS; i++) {
+            scan();
+        }
+    });
+
+    EXPECT_EQ(key_events, 0);
+}
+
+TEST_F(MatrixTask, OneKeyPerScan) {
+    run([&] {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                press_key(col, row);
+                scan();
+                release_key(col, row);
+                scan();
+            }
+        }
+    });
+
+    EXPECT_EQ(key_events, scans);
+}
+
+TEST_F(MatrixTask, AllKeysPerScan) {
+    run([&] {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                press_key(col, row);
+            }
+        }
+        scan();
+        clear_all_keys();
+        scan();
+    });
+
+    EXPECT_EQ(key_events, scans * MATRIX_ROWS * MATRIX_COLS);
+}
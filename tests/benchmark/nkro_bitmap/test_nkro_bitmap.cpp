@@ -0,0 +1,84 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "action_util.h"
+#include "report.h"
+}
+
+/*
+ * Looks up the first key and the number of keys of the NKRO report, with
+ * one key held, with a few held while typing, and with a chord of twenty
+ * spread over the whole bitmap.
+ *
+ * The nkro_bitmap_byte_wide benchmark builds the same test with
+ * NKRO_BITMAP_BYTE_WIDE defined, so comparing the two reports shows what
+ * scanning the bitmap a word at a time saves over the byte at a time scan
+ * used on AVR.
+ *
+ * As part of `make test`, each lookup runs a few times as a smoke test.
+ * `make benchmark:nkro_bitmap` runs them QMK_BENCHMARK_ITERATIONS times, and
+ * records the time per call as properties of the JSON test report.
+ */
+class NkroBitmap : public BenchmarkFixture {
+   protected:
+    void TearDown() override {
+        clear_keys_from_report();
+    }
+
+    template <typename Lookup>
+    uint64_t ns_per_call(Lookup lookup) {
+        // Accumulated so the calls can't be optimised away
+        volatile uint32_t sink    = 0;
+        uint64_t          elapsed = time_ns([&] {
+            for (unsigned long i = 0; i < iterations; i++) {
+                sink = sink + lookup();
+            }
+        });
+        return per(elapsed, iterations);
+    }
+
+    void run(const std::vector<uint8_t> &held) {
+        clear_keys_from_report();
+        uint8_t lowest = 0xFF;
+        for (uint8_t keycode : held) {
+            add_key_to_report(keycode);
+            lowest = std::min(lowest, keycode);
+        }
+        ASSERT_EQ(has_anykey(), held.size());
+        ASSERT_EQ(count_key_bits(nkro_report), held.size());
+        ASSERT_EQ(get_first_key(), lowest);
+
+#ifdef NKRO_BITMAP_BYTE_WIDE
+        record("bitmap_scan", "byte_wide");
+#else
+        record("bitmap_scan", "word_wide");
+#endif
+        record("keys", held.size());
+        record("get_first_key_ns", ns_per_call(get_first_key));
+        record("count_key_bits_ns", ns_per_call([] { return count_key_bits(nkro_report); }));
+        record("has_anykey_ns", ns_per_call(has_anykey));
+    }
+};
+
+TEST_F(NkroBitmap, OneKey) {
+    run({KC_SPACE});
+}
+
+TEST_F(NkroBitmap, Typing) {
+    run({KC_T, KC_H, KC_E, KC_LEFT_BRACKET});
+}
+
+TEST_F(NkroBitmap, Chord) {
+    std::vector<uint8_t> held;
+    for (uint8_t keycode = KC_RIGHT; keycode < KC_RIGHT + 20 * 7; keycode += 7) {
+        held.push_back(keycode);
+    }
+    run(held);
+}
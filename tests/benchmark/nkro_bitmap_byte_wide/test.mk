@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The nkro_bitmap benchmark, scanning the bitmap a byte at a time as on AVR
+NKRO_ENABLE = yes
+
+SRC += tests/benchmark/nkro_bitmap/test_nkro_bitmap.cpp
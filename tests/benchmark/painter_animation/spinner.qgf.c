@@ -0,0 +1,365 @@
+// Copyright 2026 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `painter_convert_graphics` with arguments:
+//    input  | spinner.gif
+//    format | pal16
+
+// Image's metadata
+// ----------------
+// Width: 64
+// Height: 64
+//        Frame:    0|   1|   2|   3|   4|   5|   6|   7|   8|   9|  10|  11|  12|  13|  14|  15|  16|  17|  18|  19|  20|  21|  22|  23|  24|  25|  26|  27|  28|  29
+// Duration(ms):   30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30|  30
+//  Compression:    1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1 >> See qp.h, painter_compression_t
+//        Delta:    0|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1|   1
+// Areas on delta frames
+// Frame   1: ( 44,  32) - ( 55,  45) >>  143/4096 pixels (3.49%)
+// Frame   2: ( 43,  35) - ( 54,  49) >>  154/4096 pixels (3.76%)
+// Frame   3: ( 41,  39) - ( 53,  52) >>  156/4096 pixels (3.81%)
+// Frame   4: ( 39,  42) - ( 51,  55) >>  156/4096 pixels (3.81%)
+// Frame   5: ( 36,  45) - ( 49,  57) >>  156/4096 pixels (3.81%)
+// Frame   6: ( 32,  47) - ( 46,  59) >>  168/4096 pixels (4.10%)
+// Frame   7: ( 28,  49) - ( 42,  59) >>  140/4096 pixels (3.42%)
+// Frame   8: ( 25,  49) - ( 38,  59) >>  130/4096 pixels (3.17%)
+// Frame   9: ( 21,  49) - ( 35,  59) >>  140/4096 pixels (3.42%)
+// Frame  10: ( 18,  47) - ( 31,  59) >>  156/4096 pixels (3.81%)
+// Frame  11: ( 14,  45) - ( 28,  57) >>  168/4096 pixels (4.10%)
+// Frame  12: ( 12,  42) - ( 24,  55) >>  156/4096 pixels (3.81%)
+// Frame  13: ( 10,  39) - ( 22,  52) >>  156/4096 pixels (3.81%)
+// Frame  14: (  9,  35) - ( 20,  49) >>  154/4096 pixels (3.76%)
+// Frame  15: (  9,  32) - ( 19,  45) >>  130/4096 pixels (3.17%)
+// Frame  16: (  9,  28) - ( 19,  42) >>  140/4096 pixels (3.42%)
+// Frame  17: (  9,  24) - ( 20,  38) >>  154/4096 pixels (3.76%)
+// Frame  18: ( 10,  21) - ( 22,  34) >>  156/4096 pixels (3.81%)
+// Frame  19: ( 12,  18) - ( 24,  31) >>  156/4096 pixels (3.81%)
+// Frame  20: ( 14,  16) - ( 27,  28) >>  156/4096 pixels (3.81%)
+// Frame  21: ( 17,  14) - ( 31,  26) >>  168/4096 pixels (4.10%)
+// Frame  22: ( 21,  14) - ( 35,  24) >>  140/4096 pixels (3.42%)
+// Frame  23: ( 25,  14) - ( 38,  24) >>  130/4096 pixels (3.17%)
+// Frame  24: ( 28,  14) - ( 42,  24) >>  140/4096 pixels (3.42%)
+// Frame  25: ( 32,  14) - ( 46,  26) >>  168/4096 pixels (4.10%)
+// Frame  26: ( 36,  16) - ( 49,  28) >>  156/4096 pixels (3.81%)
+// Frame  27: ( 39,  18) - ( 51,  31) >>  156/4096 pixels (3.81%)
+// Frame  28: ( 41,  21) - ( 53,  34) >>  156/4096 pixels (3.81%)
+// Frame  29: ( 43,  24) - ( 54,  38) >>  154/4096 pixels (3.76%)
+
+#include <qp.h>
+
+const uint32_t gfx_spinner_length = 4961;
+
+// clang-format off
+const uint8_t gfx_spinner[4961] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x61, 0x13, 0x00, 0x00, 0x9E, 0xEC, 0xFF,
+    0xFF, 0x40, 0x00, 0x40, 0x00, 0x1E, 0x00, 0x01, 0xFE, 0x78, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+    0x64, 0x03, 0x00, 0x00, 0xED, 0x03, 0x00, 0x00, 0x76, 0x04, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
+    0x92, 0x05, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0xB6, 0x06, 0x00, 0x00, 0x49, 0x07, 0x00, 0x00,
+    0xD8, 0x07, 0x00, 0x00, 0x6B, 0x08, 0x00, 0x00, 0xFA, 0x08, 0x00, 0x00, 0x8D, 0x09, 0x00, 0x00,
+    0x1A, 0x0A, 0x00, 0x00, 0xA7, 0x0A, 0x00, 0x00, 0x2F, 0x0B, 0x00, 0x00, 0xA6, 0x0B, 0x00, 0x00,
+    0x1F, 0x0C, 0x00, 0x00, 0xA8, 0x0C, 0x00, 0x00, 0x36, 0x0D, 0x00, 0x00, 0xC4, 0x0D, 0x00, 0x00,
+    0x54, 0x0E, 0x00, 0x00, 0xE8, 0x0E, 0x00, 0x00, 0x7B, 0x0F, 0x00, 0x00, 0x0A, 0x10, 0x00, 0x00,
+    0x9D, 0x10, 0x00, 0x00, 0x30, 0x11, 0x00, 0x00, 0xBF, 0x11, 0x00, 0x00, 0x4C, 0x12, 0x00, 0x00,
+    0xD9, 0x12, 0x00, 0x00, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0x1E, 0x00, 0x03,
+    0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x6A, 0xED, 0xEF, 0x6A, 0xCF, 0xD7, 0x6A, 0xAD, 0xC1,
+    0x6A, 0x81, 0xAB, 0x0D, 0xFF, 0xFF, 0xE9, 0x71, 0xA4, 0x6A, 0x4F, 0x97, 0x6B, 0x1C, 0x87, 0xE8,
+    0x18, 0x86, 0xE9, 0x46, 0x94, 0xE9, 0xA0, 0xBA, 0xE9, 0xC2, 0xCE, 0xE9, 0xDB, 0xE0, 0xE9, 0xF1,
+    0xF2, 0xAA, 0xFF, 0x28, 0x05, 0xFA, 0x8B, 0x02, 0x00, 0x20, 0x00, 0x80, 0x10, 0x03, 0x11, 0x02,
+    0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77, 0x81, 0x87, 0x88, 0x02, 0x99,
+    0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE, 0x0E, 0x10,
+    0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77, 0x81, 0x87,
+    0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED,
+    0xEE, 0x0E, 0x10, 0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02,
+    0x77, 0x81, 0x87, 0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02,
+    0xDD, 0x83, 0xED, 0xEE, 0x0E, 0x10, 0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43,
+    0x02, 0x44, 0x02, 0x77, 0x81, 0x87, 0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB,
+    0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE, 0x0E, 0x10, 0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02,
+    0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77, 0x81, 0x87, 0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02,
+    0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE, 0x0E, 0x10, 0x03, 0x11, 0x02, 0x22,
+    0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77, 0x81, 0x87, 0x88, 0x02, 0x99, 0x81,
+    0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE, 0x0E, 0x10, 0x03,
+    0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77, 0x81, 0x87, 0x88,
+    0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE,
+    0x0E, 0x10, 0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02, 0x44, 0x02, 0x77,
+    0x81, 0x87, 0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02, 0xCC, 0x02, 0xDD,
+    0x83, 0xED, 0xEE, 0x0E, 0x10, 0x03, 0x11, 0x02, 0x22, 0x80, 0x32, 0x02, 0x33, 0x80, 0x43, 0x02,
+    0x44, 0x02, 0x77, 0x81, 0x87, 0x88, 0x02, 0x99, 0x81, 0xAA, 0x6A, 0x02, 0x66, 0x03, 0xBB, 0x02,
+    0xCC, 0x02, 0xDD, 0x83, 0xED, 0xEE, 0x0E, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81,
+    0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F,
+    0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0,
+    0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E,
+    0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF,
+    0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81,
+    0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F,
+    0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x17, 0xFF, 0x02, 0x55, 0x80, 0xF5, 0x04, 0xFF, 0x81, 0x0F,
+    0xF0, 0x16, 0xFF, 0x80, 0x5F, 0x03, 0x55, 0x04, 0xFF, 0x81, 0x0F, 0xF0, 0x16, 0xFF, 0x04, 0x55,
+    0x80, 0xF5, 0x03, 0xFF, 0x81, 0x0F, 0xF0, 0x15, 0xFF, 0x80, 0x5F, 0x05, 0x55, 0x03, 0xFF, 0x81,
+    0x0F, 0xF0, 0x15, 0xFF, 0x80, 0x5F, 0x05, 0x55, 0x03, 0xFF, 0x81, 0x0F, 0xF0, 0x15, 0xFF, 0x80,
+    0x5F, 0x05, 0x55, 0x03, 0xFF, 0x81, 0x0F, 0xF0, 0x15, 0xFF, 0x80, 0x5F, 0x05, 0x55, 0x03, 0xFF,
+    0x81, 0x0F, 0xF0, 0x15, 0xFF, 0x80, 0x5F, 0x05, 0x55, 0x03, 0xFF, 0x81, 0x0F, 0xF0, 0x16, 0xFF,
+    0x04, 0x55, 0x80, 0xF5, 0x03, 0xFF, 0x81, 0x0F, 0xF0, 0x16, 0xFF, 0x80, 0x5F, 0x03, 0x55, 0x04,
+    0xFF, 0x81, 0x0F, 0xF0, 0x17, 0xFF, 0x02, 0x55, 0x80, 0xF5, 0x04, 0xFF, 0x81, 0x0F, 0xF0, 0x1E,
+    0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF,
+    0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81,
+    0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F,
+    0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0,
+    0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E,
+    0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF, 0x81, 0x0F, 0xF0, 0x1E, 0xFF,
+    0x80, 0x0F, 0x20, 0x00, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03,
+    0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2D,
+    0x00, 0x05, 0xFA, 0x37, 0x00, 0x00, 0x13, 0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11, 0x03, 0x00,
+    0x82, 0x10, 0x11, 0x01, 0x04, 0x00, 0x80, 0x11, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80, 0x10,
+    0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x81, 0x10, 0x01, 0x04, 0x00, 0x02,
+    0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x02, 0x00, 0x02, 0x11, 0x02, 0xFD, 0x06,
+    0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08,
+    0x00, 0x00, 0x2B, 0x00, 0x23, 0x00, 0x36, 0x00, 0x31, 0x00, 0x05, 0xFA, 0x37, 0x00, 0x00, 0x19,
+    0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11, 0x03, 0x00, 0x82, 0x10, 0x11, 0x01, 0x04, 0x00, 0x80,
+    0x11, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80,
+    0x10, 0x05, 0x00, 0x81, 0x10, 0x01, 0x04, 0x00, 0x02, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11,
+    0x80, 0x01, 0x02, 0x00, 0x02, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E,
+    0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x29, 0x00, 0x27, 0x00, 0x35,
+    0x00, 0x34, 0x00, 0x05, 0xFA, 0x3C, 0x00, 0x00, 0x15, 0x11, 0x02, 0x00, 0x80, 0x10, 0x03, 0x11,
+    0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x04, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01,
+    0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81,
+    0x10, 0x11, 0x04, 0x00, 0x80, 0x10, 0x02, 0x11, 0x03, 0x00, 0x80, 0x10, 0x03, 0x11, 0x02, 0x00,
+    0x80, 0x10, 0x02, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03,
+    0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x27, 0x00, 0x2A, 0x00, 0x33, 0x00, 0x37,
+    0x00, 0x05, 0xFA, 0x3C, 0x00, 0x00, 0x15, 0x11, 0x02, 0x00, 0x80, 0x10, 0x03, 0x11, 0x03, 0x00,
+    0x80, 0x10, 0x02, 0x11, 0x04, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00,
+    0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11,
+    0x04, 0x00, 0x80, 0x10, 0x02, 0x11, 0x03, 0x00, 0x80, 0x10, 0x03, 0x11, 0x02, 0x00, 0x80, 0x10,
+    0x02, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x24, 0x00, 0x2D, 0x00, 0x31, 0x00, 0x39, 0x00, 0x05,
+    0xFA, 0x3E, 0x00, 0x00, 0x0F, 0x11, 0x80, 0x01, 0x02, 0x00, 0x04, 0x11, 0x03, 0x00, 0x80, 0x10,
+    0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81,
+    0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x82, 0x10,
+    0x11, 0x01, 0x04, 0x00, 0x03, 0x11, 0x03, 0x00, 0x80, 0x10, 0x03, 0x11, 0x80, 0x01, 0x02, 0x00,
+    0x03, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x3B, 0x00, 0x05,
+    0xFA, 0x42, 0x00, 0x00, 0x10, 0x11, 0x80, 0x01, 0x02, 0x00, 0x04, 0x11, 0x80, 0x01, 0x03, 0x00,
+    0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00,
+    0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00,
+    0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04, 0x11, 0x80, 0x01,
+    0x02, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E,
+    0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x1C, 0x00, 0x31, 0x00, 0x2A,
+    0x00, 0x3B, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02, 0x00, 0x04, 0x11, 0x80,
+    0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x05, 0x00, 0x02,
+    0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11,
+    0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04,
+    0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02,
+    0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x19, 0x00,
+    0x31, 0x00, 0x26, 0x00, 0x3B, 0x00, 0x05, 0xFA, 0x3D, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02, 0x00,
+    0x04, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x05, 0x00,
+    0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81,
+    0x10, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x04, 0x00, 0x03, 0x11, 0x03, 0x00, 0x80, 0x10,
+    0x03, 0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01,
+    0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x15, 0x00, 0x31,
+    0x00, 0x23, 0x00, 0x3B, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02, 0x00, 0x04,
+    0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x05,
+    0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82,
+    0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80, 0x01, 0x03,
+    0x00, 0x04, 0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0xFD, 0x06, 0x00, 0x00,
+    0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00,
+    0x12, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x3B, 0x00, 0x05, 0xFA, 0x3D, 0x00, 0x00, 0x81, 0x11, 0x01,
+    0x02, 0x00, 0x04, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11,
+    0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x05,
+    0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x04, 0x00, 0x03, 0x11, 0x03, 0x00,
+    0x80, 0x10, 0x03, 0x11, 0x80, 0x01, 0x02, 0x00, 0x11, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06,
+    0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x0E,
+    0x00, 0x2D, 0x00, 0x1C, 0x00, 0x39, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02,
+    0x00, 0x04, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80,
+    0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05,
+    0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80,
+    0x01, 0x03, 0x00, 0x04, 0x11, 0x80, 0x01, 0x02, 0x00, 0x12, 0x11, 0x80, 0x01, 0x02, 0xFD, 0x06,
+    0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08,
+    0x00, 0x00, 0x0C, 0x00, 0x2A, 0x00, 0x18, 0x00, 0x37, 0x00, 0x05, 0xFA, 0x3B, 0x00, 0x00, 0x81,
+    0x11, 0x01, 0x02, 0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00,
+    0x81, 0x11, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11,
+    0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01,
+    0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0x00, 0x16, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06,
+    0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x0A,
+    0x00, 0x27, 0x00, 0x16, 0x00, 0x34, 0x00, 0x05, 0xFA, 0x3B, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02,
+    0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x81, 0x11, 0x01,
+    0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81,
+    0x10, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03,
+    0x11, 0x80, 0x01, 0x02, 0x00, 0x16, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF,
+    0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x09, 0x00, 0x23, 0x00,
+    0x14, 0x00, 0x31, 0x00, 0x05, 0xFA, 0x36, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02, 0x00, 0x03, 0x11,
+    0x03, 0x00, 0x82, 0x10, 0x11, 0x01, 0x04, 0x00, 0x80, 0x11, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00,
+    0x80, 0x10, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x81, 0x10, 0x01, 0x04,
+    0x00, 0x02, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x02, 0x00, 0x1A, 0x11, 0x02,
+    0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFB, 0x08, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x13, 0x00, 0x2D, 0x00, 0x05, 0xFA, 0x25, 0x00,
+    0x00, 0x81, 0x11, 0x01, 0x02, 0x00, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x81, 0x11, 0x01, 0x04,
+    0x00, 0x80, 0x01, 0x1B, 0x00, 0x80, 0x01, 0x04, 0x00, 0x81, 0x11, 0x01, 0x03, 0x00, 0x02, 0x11,
+    0x80, 0x01, 0x02, 0x00, 0x12, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E,
+    0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x09, 0x00, 0x1C, 0x00, 0x13,
+    0x00, 0x2A, 0x00, 0x05, 0xFA, 0x27, 0x00, 0x00, 0x81, 0x11, 0x01, 0x02, 0x00, 0x02, 0x11, 0x80,
+    0x01, 0x03, 0x00, 0x81, 0x11, 0x01, 0x04, 0x00, 0x80, 0x01, 0x1B, 0x00, 0x80, 0x01, 0x04, 0x00,
+    0x81, 0x11, 0x01, 0x03, 0x00, 0x02, 0x11, 0x80, 0x01, 0x02, 0x00, 0x17, 0x11, 0x80, 0x01, 0x02,
+    0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFB, 0x08, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x14, 0x00, 0x26, 0x00, 0x05, 0xFA, 0x37, 0x00,
+    0x00, 0x02, 0x11, 0x02, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x04,
+    0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x01, 0x05, 0x00, 0x80, 0x01, 0x05, 0x00, 0x80, 0x01,
+    0x05, 0x00, 0x80, 0x01, 0x05, 0x00, 0x80, 0x11, 0x04, 0x00, 0x82, 0x10, 0x11, 0x01, 0x03, 0x00,
+    0x03, 0x11, 0x02, 0x00, 0x80, 0x10, 0x19, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01,
+    0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x0A, 0x00, 0x15,
+    0x00, 0x16, 0x00, 0x22, 0x00, 0x05, 0xFA, 0x3C, 0x00, 0x00, 0x02, 0x11, 0x80, 0x01, 0x02, 0x00,
+    0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x81, 0x11, 0x01, 0x05,
+    0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10,
+    0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11,
+    0x80, 0x01, 0x02, 0x00, 0x15, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E,
+    0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x18,
+    0x00, 0x1F, 0x00, 0x05, 0xFA, 0x3C, 0x00, 0x00, 0x02, 0x11, 0x80, 0x01, 0x02, 0x00, 0x03, 0x11,
+    0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x80,
+    0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05,
+    0x00, 0x81, 0x11, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01,
+    0x02, 0x00, 0x15, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03,
+    0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x1C,
+    0x00, 0x05, 0xFA, 0x3E, 0x00, 0x00, 0x03, 0x11, 0x02, 0x00, 0x80, 0x10, 0x03, 0x11, 0x80, 0x01,
+    0x03, 0x00, 0x03, 0x11, 0x04, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05,
+    0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00,
+    0x02, 0x11, 0x04, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04, 0x11, 0x02, 0x00,
+    0x80, 0x10, 0x0F, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03,
+    0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x1A,
+    0x00, 0x05, 0xFA, 0x42, 0x00, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0x00, 0x04, 0x11, 0x80, 0x01,
+    0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01, 0x05, 0x00, 0x02, 0x11,
+    0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01,
+    0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04, 0x11,
+    0x80, 0x01, 0x02, 0x00, 0x10, 0x11, 0x80, 0x01, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01,
+    0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x15, 0x00, 0x0E,
+    0x00, 0x23, 0x00, 0x18, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x03, 0x11, 0x80, 0x01, 0x02, 0x00,
+    0x04, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11, 0x80, 0x01,
+    0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00,
+    0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11, 0x80, 0x01,
+    0x03, 0x00, 0x04, 0x11, 0x80, 0x01, 0x02, 0x00, 0x81, 0x11, 0x01, 0x02, 0xFD, 0x06, 0x00, 0x00,
+    0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00,
+    0x19, 0x00, 0x0E, 0x00, 0x26, 0x00, 0x18, 0x00, 0x05, 0xFA, 0x3D, 0x00, 0x00, 0x03, 0x11, 0x02,
+    0x00, 0x80, 0x10, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x04, 0x00, 0x82, 0x10, 0x11,
+    0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01,
+    0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x04, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80,
+    0x01, 0x03, 0x00, 0x04, 0x11, 0x02, 0x00, 0x81, 0x10, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06,
+    0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x1C,
+    0x00, 0x0E, 0x00, 0x2A, 0x00, 0x18, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x03, 0x11, 0x80, 0x01,
+    0x02, 0x00, 0x04, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04, 0x00, 0x02, 0x11,
+    0x80, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11,
+    0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04, 0x00, 0x03, 0x11,
+    0x80, 0x01, 0x03, 0x00, 0x04, 0x11, 0x80, 0x01, 0x02, 0x00, 0x81, 0x11, 0x01, 0x02, 0xFD, 0x06,
+    0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08,
+    0x00, 0x00, 0x20, 0x00, 0x0E, 0x00, 0x2E, 0x00, 0x1A, 0x00, 0x05, 0xFA, 0x41, 0x00, 0x00, 0x12,
+    0x11, 0x80, 0x01, 0x02, 0x00, 0x04, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11, 0x80, 0x01, 0x04,
+    0x00, 0x02, 0x11, 0x80, 0x01, 0x05, 0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05,
+    0x00, 0x02, 0x11, 0x05, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x80, 0x01, 0x04,
+    0x00, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04, 0x11, 0x80, 0x01, 0x02, 0x00, 0x81, 0x11, 0x01,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFB, 0x08, 0x00, 0x00, 0x24, 0x00, 0x10, 0x00, 0x31, 0x00, 0x1C, 0x00, 0x05, 0xFA, 0x3D,
+    0x00, 0x00, 0x11, 0x11, 0x02, 0x00, 0x80, 0x10, 0x03, 0x11, 0x80, 0x01, 0x03, 0x00, 0x03, 0x11,
+    0x04, 0x00, 0x82, 0x10, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01,
+    0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x81, 0x11, 0x01, 0x05, 0x00, 0x02, 0x11, 0x04, 0x00,
+    0x80, 0x10, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x04, 0x11, 0x02, 0x00, 0x81, 0x10, 0x11, 0x02,
+    0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFB, 0x08, 0x00, 0x00, 0x27, 0x00, 0x12, 0x00, 0x33, 0x00, 0x1F, 0x00, 0x05, 0xFA, 0x3B, 0x00,
+    0x00, 0x16, 0x11, 0x02, 0x00, 0x80, 0x10, 0x03, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x04,
+    0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81,
+    0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x04, 0x00, 0x80, 0x10, 0x02,
+    0x11, 0x03, 0x00, 0x80, 0x10, 0x03, 0x11, 0x02, 0x00, 0x81, 0x10, 0x11, 0x02, 0xFD, 0x06, 0x00,
+    0x00, 0x06, 0x02, 0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA,
+    0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00,
+    0x00, 0x29, 0x00, 0x15, 0x00, 0x35, 0x00, 0x22, 0x00, 0x05, 0xFA, 0x3B, 0x00, 0x00, 0x16, 0x11,
+    0x02, 0x00, 0x80, 0x10, 0x03, 0x11, 0x03, 0x00, 0x80, 0x10, 0x02, 0x11, 0x04, 0x00, 0x81, 0x10,
+    0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x01, 0x05,
+    0x00, 0x80, 0x11, 0x05, 0x00, 0x81, 0x10, 0x11, 0x04, 0x00, 0x80, 0x10, 0x02, 0x11, 0x03, 0x00,
+    0x80, 0x10, 0x03, 0x11, 0x02, 0x00, 0x81, 0x10, 0x11, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02,
+    0x01, 0xFF, 0x1E, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xAA, 0xFF, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x2B, 0x00,
+    0x18, 0x00, 0x36, 0x00, 0x26, 0x00, 0x05, 0xFA, 0x36, 0x00, 0x00, 0x1A, 0x11, 0x02, 0x00, 0x80,
+    0x10, 0x02, 0x11, 0x80, 0x01, 0x03, 0x00, 0x02, 0x11, 0x04, 0x00, 0x81, 0x10, 0x01, 0x05, 0x00,
+    0x80, 0x01, 0x05, 0x00, 0x80, 0x01, 0x05, 0x00, 0x80, 0x01, 0x05, 0x00, 0x80, 0x01, 0x05, 0x00,
+    0x80, 0x11, 0x04, 0x00, 0x82, 0x10, 0x11, 0x01, 0x03, 0x00, 0x03, 0x11, 0x02, 0x00, 0x81, 0x10,
+    0x11,
+};
+// clang-format on
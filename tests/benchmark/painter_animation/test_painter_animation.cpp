@@ -0,0 +1,131 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "spinner.qgf.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+
+void advance_time(uint32_t ms);
+void qp_internal_animation_tick(void);
+}
+
+// Every frame of the spinner is shown for 30ms
+#define FRAME_DELAY_MS 30
+
+/*
+ * Plays a 30 frame animation through qp_animate() on an RGB565 surface. The
+ * animation was generated by `qmk painter-convert-graphics -f pal16` from a
+ * dot circling over a static background, so it's made up of one full frame
+ * followed by small, RLE compressed delta frames, with two distinct palettes.
+ *
+ * The first loop parses every frame from the image. Later loops can use the
+ * frames cached by the animation, and have to draw exactly the same pixels.
+ * The painter_animation_uncached benchmark builds the same test without the
+ * cache, to compare the decode times with and without it.
+ *
+ * As part of `make test`, the animation loops a few times as a smoke test.
+ * `make benchmark:painter_animation` loops it QMK_BENCHMARK_ITERATIONS times,
+ * and records the decode time per frame as properties of the JSON test report.
+ */
+static surface_painter_driver_vtable_t surface_vtable;
+static uint32_t                        palette_conversions;
+
+static bool counting_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    palette_conversions++;
+    return rgb565_surface_driver_vtable.base.palette_convert(device, palette_size, palette);
+}
+
+class PainterAnimation : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        image = qp_load_image_mem(gfx_spinner);
+        ASSERT_NE(image, nullptr);
+
+        surface_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(image->width, image->height, 16), 0);
+        surface = qp_make_rgb565_surface_advanced(&surface_device, 1, image->width, image->height, surface_data.data());
+
+        surface_vtable                     = rgb565_surface_driver_vtable;
+        surface_vtable.base.palette_convert = counting_palette_convert;
+        surface_device.base.driver_vtable  = (painter_driver_vtable_t *)&surface_vtable;
+
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    void TearDown() override {
+        qp_close_image(image);
+    }
+
+    /* Waits for the next frame of the animation, returning how long it took to draw. */
+    uint64_t next_frame_ns(void) {
+        advance_time(FRAME_DELAY_MS);
+        uint64_t elapsed = time_ns(qp_internal_animation_tick);
+
+        // Every tick draws something, as every frame differs from the previous one
+        EXPECT_GT(surface_device.dirty.count, 0);
+        qp_flush(surface);
+        return elapsed;
+    }
+
+    painter_image_handle_t   image;
+    surface_painter_device_t surface_device = {};
+    std::vector<uint8_t>     surface_data;
+    painter_device_t         surface;
+};
+
+TEST_F(PainterAnimation, Playback) {
+    std::vector<std::vector<uint8_t>> frames;
+    uint64_t                          first_loop_ns          = 0;
+    uint32_t                          first_loop_conversions = 0;
+
+    // The first frame is drawn straight away
+    palette_conversions  = 0;
+    deferred_token token = INVALID_DEFERRED_TOKEN;
+    first_loop_ns        = time_ns([&] { token = qp_animate(surface, 0, 0, image); });
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    qp_flush(surface);
+    frames.push_back(surface_data);
+
+    for (uint16_t frame = 1; frame < image->frame_count; frame++) {
+        first_loop_ns += next_frame_ns();
+        frames.push_back(surface_data);
+    }
+    first_loop_conversions = palette_conversions;
+
+    // Later loops draw the same frames again
+    uint64_t cached_ns         = 0;
+    uint32_t max_conversions   = 0;
+    bool     frames_consistent = true;
+    for (unsigned long loop = 0; loop < iterations; loop++) {
+        palette_conversions = 0;
+        for (uint16_t frame = 0; frame < image->frame_count; frame++) {
+            cached_ns += next_frame_ns();
+            frames_consistent &= surface_data == frames[frame];
+        }
+        max_conversions = QP_MAX(max_conversions, palette_conversions);
+    }
+    EXPECT_TRUE(frames_consistent);
+
+    qp_stop_animation(token);
+
+    record("frames", image->frame_count);
+    record("first_loop_ns_per_frame", per(first_loop_ns, image->frame_count));
+    record("ns_per_frame", per(cached_ns, iterations * image->frame_count));
+    record("first_loop_palette_conversions", first_loop_conversions);
+    record("palette_conversions_per_loop", max_conversions);
+
+#if QUANTUM_PAINTER_ANIMATION_CACHED_FRAMES > 0
+    // Every frame is cached, and consecutive frames sharing a palette only have it converted once
+    EXPECT_EQ(max_conversions, 2);
+#else
+    // Without the cache, every frame loads its own palette
+    EXPECT_EQ(max_conversions, image->frame_count);
+#endif
+}
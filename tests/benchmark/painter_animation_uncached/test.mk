@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The painter_animation benchmark, without any frames cached by the animation
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += \
+	tests/benchmark/painter_animation/spinner.qgf.c \
+	tests/benchmark/painter_animation/test_painter_animation.cpp
@@ -0,0 +1,180 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define IMAGE_WIDTH 240
+#define IMAGE_HEIGHT 135
+#define IMAGE_PIXELS (IMAGE_WIDTH * IMAGE_HEIGHT)
+
+/*
+ * Decodes a 16 colour palette image into an RGB565 surface, the way
+ * qp_drawimage() does, uncompressed and RLE compressed:
+ *
+ * - per_pixel: qp_internal_decode_palette() with qp_internal_pixel_appender(),
+ *   which is how qp_internal_appender() decoded palette images before, with
+ *   one byte read through the input callback and one append_pixels() call
+ *   per pixel.
+ * - batched: qp_internal_appender() as it is now, reading the encoded bytes
+ *   and appending the pixels a batch at a time.
+ *
+ * Both have to draw exactly the same pixels.
+ *
+ * As part of `make test`, the image is decoded a few times as a smoke test.
+ * `make benchmark:painter_codec` decodes it QMK_BENCHMARK_ITERATIONS times,
+ * and records the decode time per image as properties of the JSON test report.
+ */
+static surface_painter_driver_vtable_t surface_vtable;
+static uint32_t                        append_calls;
+
+static bool counting_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    append_calls++;
+    return rgb565_surface_driver_vtable.base.append_pixels(device, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+}
+
+static bool per_pixel_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void *input_state) {
+    qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+
+    bool ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+    if (ret && output_state.pixel_write_pos > 0) {
+        ret &= qp_internal_send_pixdata(device, output_state.pixel_write_pos);
+    }
+    return ret;
+}
+
+/* A status screen of sorts: flat bands of colour, with rows of noisy detail like text or icons across some of them. */
+static std::vector<uint8_t> make_image(void) {
+    std::vector<uint8_t> data(IMAGE_PIXELS / 2);
+    uint32_t             seed = 1;
+    for (uint32_t i = 0; i < IMAGE_PIXELS; i += 2) {
+        uint16_t y     = i / IMAGE_WIDTH;
+        uint8_t  index = y / 17;
+        if (y % 17 >= 4 && y % 17 < 12 && (i % IMAGE_WIDTH) < 180) {
+            seed  = seed * 1103515245 + 12345;
+            index = (seed >> 16) & 0xFF;
+            data[i / 2] = index;
+        } else {
+            data[i / 2] = index | index << 4;
+        }
+    }
+    return data;
+}
+
+/* Encodes the way `qmk painter-convert-graphics` does: up to 127 repeats of a byte, or up to 128 bytes as they are. */
+static std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && run < 127 && data[i + run] == data[i]) {
+            run++;
+        }
+        if (run > 1) {
+            out.push_back(run);
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        size_t literal = 1;
+        while (i + literal < data.size() && literal < 128 && (i + literal + 1 >= data.size() || data[i + literal] != data[i + literal + 1])) {
+            literal++;
+        }
+        out.push_back(127 + literal);
+        out.insert(out.end(), data.begin() + i, data.begin() + i + literal);
+        i += literal;
+    }
+    return out;
+}
+
+class PainterCodec : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        surface_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(IMAGE_WIDTH, IMAGE_HEIGHT, 16), 0);
+        surface = qp_make_rgb565_surface_advanced(&surface_device, 1, IMAGE_WIDTH, IMAGE_HEIGHT, surface_data.data());
+
+        surface_vtable                    = rgb565_surface_driver_vtable;
+        surface_vtable.base.append_pixels = counting_append_pixels;
+        surface_device.base.driver_vtable = (painter_driver_vtable_t *)&surface_vtable;
+
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        // A 16 step gradient, as the palette of a pal16 image would be
+        for (uint8_t i = 0; i < 16; i++) {
+            qp_internal_global_pixel_lookup_table[i].hsv888 = {.h = (uint8_t)(i * 16), .s = 255, .v = (uint8_t)(128 + i * 8)};
+        }
+        ASSERT_TRUE(surface_vtable.base.palette_convert(surface, 16, qp_internal_global_pixel_lookup_table));
+    }
+
+    /* Decodes the encoded image into the surface, returning how long it took. */
+    template <typename Appender>
+    uint64_t decode_ns(Appender appender, std::vector<uint8_t> &encoded, painter_compression_t compression) {
+        qp_memory_stream_t             stream      = qp_make_memory_stream(encoded.data(), encoded.size());
+        qp_internal_byte_input_state_t input_state = {.device = surface, .src_stream = (qp_stream_t *)&stream};
+
+        uint64_t elapsed = time_ns([&] {
+            EXPECT_TRUE(qp_comms_start(surface));
+            EXPECT_TRUE(qp_viewport(surface, 0, 0, IMAGE_WIDTH - 1, IMAGE_HEIGHT - 1));
+            qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+            EXPECT_TRUE(appender(surface, 4, IMAGE_PIXELS, input_callback, &input_state));
+            qp_comms_stop(surface);
+        });
+
+        qp_flush(surface);
+        return elapsed;
+    }
+
+    void run(const char *name, std::vector<uint8_t> &encoded, painter_compression_t compression) {
+        std::vector<uint8_t> decoded[2];
+        uint64_t             ns[2]    = {0, 0};
+        uint32_t             calls[2] = {0, 0};
+        for (int variant = 0; variant < 2; variant++) {
+            auto appender = variant == 0 ? per_pixel_appender : qp_internal_appender;
+            for (unsigned long i = 0; i < iterations; i++) {
+                std::fill(surface_data.begin(), surface_data.end(), 0);
+                append_calls = 0;
+                ns[variant] += decode_ns(appender, encoded, compression);
+                calls[variant] = append_calls;
+            }
+            decoded[variant] = surface_data;
+        }
+        EXPECT_TRUE(decoded[0] == decoded[1]);
+
+        std::string prefix = name;
+        record(prefix + "_bytes", encoded.size());
+        record(prefix + "_per_pixel_ns_per_image", per(ns[0], iterations));
+        record(prefix + "_batched_ns_per_image", per(ns[1], iterations));
+        record(prefix + "_per_pixel_append_calls", calls[0]);
+        record(prefix + "_batched_append_calls", calls[1]);
+
+        // One call per pixel, against one per batch
+        EXPECT_EQ(calls[0], IMAGE_PIXELS);
+        EXPECT_LT(calls[1] * 16, calls[0]);
+    }
+
+    surface_painter_device_t surface_device = {};
+    std::vector<uint8_t>     surface_data;
+    painter_device_t         surface;
+};
+
+TEST_F(PainterCodec, Uncompressed) {
+    std::vector<uint8_t> image = make_image();
+    run("uncompressed", image, IMAGE_UNCOMPRESSED);
+}
+
+TEST_F(PainterCodec, Rle) {
+    std::vector<uint8_t> image = rle_encode(make_image());
+    run("rle", image, IMAGE_COMPRESSED_RLE);
+}
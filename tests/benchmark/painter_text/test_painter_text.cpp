@@ -0,0 +1,103 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "thintel15.qff.h"
+}
+
+#define SURFACE_WIDTH 240
+#define SURFACE_HEIGHT 135
+
+/*
+ * Measures and draws the lines of a status screen in the thintel15 font, on
+ * an RGB565 surface, the way a keymap redraws its display.
+ *
+ * The painter_text_glyph_table benchmark builds the same test with
+ * QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE enabled, so comparing the two
+ * reports shows what keeping the ASCII glyph table in RAM saves per glyph.
+ *
+ * As part of `make test`, the screen is drawn a few times as a smoke test.
+ * `make benchmark:painter_text` draws it QMK_BENCHMARK_ITERATIONS times, and
+ * records the time per glyph as properties of the JSON test report.
+ */
+static const char *const status_lines[] = {
+    "Layer: Lower",
+    "WPM: 073  Caps: off",
+    "CTL SFT ALT GUI",
+    "The quick brown fox jumps over the lazy dog",
+    "0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~",
+};
+
+class PainterText : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        font = qp_load_font_mem(font_thintel15);
+        ASSERT_NE(font, nullptr);
+
+        surface_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16), 0);
+        surface = qp_make_rgb565_surface_advanced(&surface_device, 1, SURFACE_WIDTH, SURFACE_HEIGHT, surface_data.data());
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        for (const char *line : status_lines) {
+            glyphs += strlen(line);
+        }
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    painter_font_handle_t    font;
+    surface_painter_device_t surface_device = {};
+    std::vector<uint8_t>     surface_data;
+    painter_device_t         surface;
+    uint32_t                 glyphs = 0;
+};
+
+TEST_F(PainterText, StatusScreen) {
+    std::vector<int16_t> widths;
+    for (const char *line : status_lines) {
+        widths.push_back(qp_textwidth(font, line));
+        EXPECT_GT(widths.back(), 0);
+    }
+
+    uint64_t             textwidth_ns = 0;
+    uint64_t             drawtext_ns  = 0;
+    bool                 consistent   = true;
+    std::vector<uint8_t> first_screen;
+    for (unsigned long i = 0; i < iterations; i++) {
+        textwidth_ns += time_ns([&] {
+            for (size_t line = 0; line < widths.size(); line++) {
+                consistent &= qp_textwidth(font, status_lines[line]) == widths[line];
+            }
+        });
+        drawtext_ns += time_ns([&] {
+            for (size_t line = 0; line < widths.size(); line++) {
+                consistent &= qp_drawtext(surface, 0, line * font->line_height, font, status_lines[line]) == widths[line];
+            }
+        });
+
+        qp_flush(surface);
+        if (i == 0) {
+            first_screen = surface_data;
+        }
+        consistent &= surface_data == first_screen;
+    }
+    EXPECT_TRUE(consistent);
+
+#if QUANTUM_PAINTER_CACHE_FONT_GLYPH_TABLE
+    record("glyph_table_cached", "true");
+#else
+    record("glyph_table_cached", "false");
+#endif
+    record("glyphs", glyphs);
+    record("textwidth_ns_per_glyph", per(textwidth_ns, iterations * glyphs));
+    record("drawtext_ns_per_glyph", per(drawtext_ns, iterations * glyphs));
+}
@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The painter_text benchmark, with each font's ASCII glyph table kept in RAM
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += \
+	tests/benchmark/painter_text/thintel15.qff.c \
+	tests/benchmark/painter_text/test_painter_text.cpp
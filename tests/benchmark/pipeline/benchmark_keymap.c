@@ -0,0 +1,25 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "benchmark_keymap.h"
+
+uint16_t const tab_combo[] = {KC_W, KC_E, COMBO_END};
+uint16_t const ent_combo[] = {KC_X, KC_C, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(tab_combo, KC_TAB),
+    COMBO(ent_combo, KC_ENT),
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_ESC_TAB] = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_TAB),
+};
+
+const key_override_t shift_bspc_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+const key_override_t *key_overrides[] = {
+    &shift_bspc_override,
+};
+// clang-format on
@@ -0,0 +1,186 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+
+#include "benchmark.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "benchmark_keymap.h"
+}
+
+/*
+ * Synthetic typing workloads driven through the whole of keyboard_task(),
+ * from the matrix through action_exec() and process_record_quantum() to the
+ * host driver.
+ *
+ * As part of `make test`, each workload runs a few times as a smoke test.
+ * `make benchmark:pipeline` runs them QMK_BENCHMARK_ITERATIONS times, and
+ * records the throughput as properties of the JSON test report.
+ */
+class Pipeline : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+
+    void scan(unsigned ms = 1) {
+        for (unsigned i = 0; i < ms; i++) {
+            run_one_scan_loop();
+            scan_loops++;
+        }
+    }
+
+    void press(KeymapKey &key) {
+        key.press();
+        scan();
+        key_events++;
+    }
+
+    void release(KeymapKey &key) {
+        key.release();
+        scan();
+        key_events++;
+    }
+
+    void tap(KeymapKey &key) {
+        press(key);
+        release(key);
+    }
+
+    void type(const char *text) {
+        for (; *text; text++) {
+            tap(keys.at(*text));
+        }
+    }
+
+    /* Sets a keymap of the letters and space, with the given overrides. */
+    void set_letters_keymap(std::map<char, uint16_t> overrides = {}) {
+        keys.clear();
+        uint8_t position = 0;
+        for (char c = 'a'; c <= 'z'; c++, position++) {
+            uint16_t keycode = overrides.count(c) ? overrides[c] : KC_A + (c - 'a');
+            keys.emplace(c, KeymapKey(0, position % MATRIX_COLS, position / MATRIX_COLS, keycode));
+        }
+        keys.emplace(' ', KeymapKey(0, position % MATRIX_COLS, position / MATRIX_COLS, KC_SPC));
+        keymap.clear();
+        for (auto &key : keys) {
+            add_key(key.second);
+        }
+    }
+
+    template <typename Workload>
+    void run(Workload workload) {
+        uint64_t elapsed = time_iterations(workload);
+
+        record("key_events", key_events);
+        record("scan_loops", scan_loops);
+        record("reports", driver.keyboard_reports);
+        record("elapsed_ns", elapsed);
+        record("ns_per_key_event", per(elapsed, key_events));
+        record("ns_per_scan_loop", per(elapsed, scan_loops));
+
+        EXPECT_GT(driver.keyboard_reports, 0);
+        EXPECT_TRUE(driver.last_keyboard_report_empty());
+    }
+
+    BenchmarkDriver           driver;
+    std::map<char, KeymapKey> keys;
+    uint64_t                  key_events = 0;
+    uint64_t                  scan_loops = 0;
+};
+
+static const char *const sentence = "quick brown fox jumps over lazy dog ";
+
+TEST_F(Pipeline, PlainTyping) {
+    set_letters_keymap();
+
+    run([&] { type(sentence); });
+
+    // Every press and release is reported
+    EXPECT_EQ(driver.keyboard_reports, key_events);
+}
+
+TEST_F(Pipeline, HomeRowMods) {
+    set_letters_keymap({{'a', LGUI_T(KC_A)}, {'s', LALT_T(KC_S)}, {'d', LCTL_T(KC_D)}, {'f', LSFT_T(KC_F)}, {'j', RSFT_T(KC_J)}, {'k', RCTL_T(KC_K)}, {'l', RALT_T(KC_L)}});
+
+    run([&] {
+        // Rolled typing, each key is pressed before the previous one is released
+        KeymapKey *previous = nullptr;
+        for (const char *c = sentence; *c; c++) {
+            KeymapKey &key = keys.at(*c);
+            press(key);
+            if (previous) {
+                release(*previous);
+            }
+            previous = &key;
+        }
+        release(*previous);
+
+        // Holding a home row mod past the tapping term to shift a letter
+        press(keys.at('f'));
+        scan(TAPPING_TERM);
+        tap(keys.at('u'));
+        release(keys.at('f'));
+    });
+}
+
+TEST_F(Pipeline, Combos) {
+    set_letters_keymap();
+
+    run([&] {
+        type("quick brown ");
+        for (int i = 0; i < 4; i++) {
+            press(keys.at('w'));
+            press(keys.at('e'));
+            release(keys.at('w'));
+            release(keys.at('e'));
+            press(keys.at('x'));
+            press(keys.at('c'));
+            release(keys.at('c'));
+            release(keys.at('x'));
+        }
+    });
+
+    // Each chord is reported as a single key
+    EXPECT_LT(driver.keyboard_reports, key_events);
+}
+
+TEST_F(Pipeline, TapDance) {
+    set_letters_keymap({{'q', TD(TD_ESC_TAB)}});
+
+    run([&] {
+        type("q");
+        scan(TAPPING_TERM);
+        type("qq");
+        scan(TAPPING_TERM);
+        type("brown fox ");
+    });
+}
+
+TEST_F(Pipeline, KeyOverrides) {
+    set_letters_keymap({{'y', KC_LSFT}, {'z', KC_BSPC}});
+
+    run([&] {
+        type("quick brown ");
+        press(keys.at('y'));
+        type("zzz");
+        release(keys.at('y'));
+        type("zz");
+    });
+}
+
+TEST_F(Pipeline, Autocorrect) {
+    set_letters_keymap();
+
+    // Every word of the second sentence is corrected
+    run([&] {
+        type("quick brown fox ");
+        type("thier lenght becuase ");
+    });
+
+    // The corrections send extra reports
+    EXPECT_GT(driver.keyboard_reports, key_events);
+}
@@ -0,0 +1,135 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "benchmark_heatmap.h"
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+
+// The defaults of typing_heatmap_anim.h
+#define HEATMAP_INCREASE_STEP 32
+#define HEATMAP_SPREAD 40
+#define HEATMAP_AREA_LIMIT 16
+
+/*
+ * A 104 key board laid out on a regular grid over the full 224x64 LED area,
+ * with every key in the matrix.
+ */
+static const uint8_t heatmap_row_lengths[] = {17, 18, 18, 17, 17, 17};
+
+_Static_assert(ARRAY_SIZE(heatmap_row_lengths) == MATRIX_ROWS, "A matrix row per row of keys");
+
+led_config_t g_led_config;
+
+void heatmap_layout_init(void) {
+    memset(g_led_config.matrix_co, NO_LED, sizeof(g_led_config.matrix_co));
+    uint8_t led = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < heatmap_row_lengths[row]; col++, led++) {
+            g_led_config.point[led]          = (led_point_t){.x = col * 224 / 17, .y = row * 64 / 5};
+            g_led_config.flags[led]          = LED_FLAG_KEYLIGHT;
+            g_led_config.matrix_co[row][col] = led;
+        }
+    }
+}
+
+void heatmap_key(uint32_t keypress, uint8_t *row, uint8_t *col) {
+    uint8_t led = keypress * 7919 % RGB_MATRIX_LED_COUNT;
+    for (*row = 0; *row < MATRIX_ROWS; (*row)++) {
+        for (*col = 0; *col < MATRIX_COLS; (*col)++) {
+            if (g_led_config.matrix_co[*row][*col] == led) {
+                return;
+            }
+        }
+    }
+}
+
+static void heatmap_init(void) {}
+
+static void heatmap_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {}
+
+static void heatmap_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void heatmap_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = heatmap_init,
+    .set_color     = heatmap_set_color,
+    .set_color_all = heatmap_set_color_all,
+    .flush         = heatmap_flush,
+};
+
+/*
+ * The keys heated up by each key, as the position in the matrix and the
+ * amount added, with the keys of the matrix position `i` starting at
+ * `heatmap_neighbour_start[i]`.
+ */
+static struct {
+    uint8_t position;
+    uint8_t amount;
+} heatmap_neighbours[MATRIX_ROWS * MATRIX_COLS * MATRIX_ROWS * MATRIX_COLS];
+static uint16_t heatmap_neighbour_start[MATRIX_ROWS * MATRIX_COLS + 1];
+static uint8_t  heatmap_copy[MATRIX_ROWS][MATRIX_COLS];
+
+static uint8_t heatmap_amount(uint8_t pressed_led, uint8_t target_led) {
+    if (pressed_led == target_led) {
+        return HEATMAP_INCREASE_STEP;
+    }
+    int16_t dx = (int16_t)g_led_config.point[target_led].x - g_led_config.point[pressed_led].x;
+    int16_t dy = (int16_t)g_led_config.point[target_led].y - g_led_config.point[pressed_led].y;
+    if (dx > HEATMAP_SPREAD || dx < -HEATMAP_SPREAD || dy > HEATMAP_SPREAD || dy < -HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t distance = sqrt16(dx * dx + dy * dy);
+    if (distance > HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t amount = qsub8(HEATMAP_SPREAD, distance);
+    return amount > HEATMAP_AREA_LIMIT ? HEATMAP_AREA_LIMIT : amount;
+}
+
+uint32_t heatmap_neighbours_init(void) {
+    uint16_t count = 0;
+    for (uint8_t pressed = 0; pressed < MATRIX_ROWS * MATRIX_COLS; pressed++) {
+        heatmap_neighbour_start[pressed] = count;
+        uint8_t pressed_led              = g_led_config.matrix_co[pressed / MATRIX_COLS][pressed % MATRIX_COLS];
+        if (pressed_led == NO_LED) {
+            continue;
+        }
+        for (uint8_t target = 0; target < MATRIX_ROWS * MATRIX_COLS; target++) {
+            uint8_t target_led = g_led_config.matrix_co[target / MATRIX_COLS][target % MATRIX_COLS];
+            if (target_led == NO_LED) {
+                continue;
+            }
+            uint8_t amount = heatmap_amount(pressed_led, target_led);
+            if (amount) {
+                heatmap_neighbours[count].position = target;
+                heatmap_neighbours[count].amount   = amount;
+                count++;
+            }
+        }
+    }
+    heatmap_neighbour_start[MATRIX_ROWS * MATRIX_COLS] = count;
+    return count * sizeof(heatmap_neighbours[0]) + sizeof(heatmap_neighbour_start);
+}
+
+void heatmap_press_neighbours(uint8_t row, uint8_t col) {
+    uint8_t  pressed = row * MATRIX_COLS + col;
+    uint8_t *buffer  = &heatmap_copy[0][0];
+    for (uint16_t i = heatmap_neighbour_start[pressed]; i < heatmap_neighbour_start[pressed + 1]; i++) {
+        buffer[heatmap_neighbours[i].position] = qadd8(buffer[heatmap_neighbours[i].position], heatmap_neighbours[i].amount);
+    }
+}
+
+void heatmap_clear(void) {
+    memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+    memset(heatmap_copy, 0, sizeof(heatmap_copy));
+}
+
+bool heatmap_buffers_match(void) {
+    return memcmp(g_rgb_frame_buffer, heatmap_copy, sizeof(heatmap_copy)) == 0;
+}
+
+uint32_t heatmap_neighbours_per_key(void) {
+    return heatmap_neighbour_start[MATRIX_ROWS * MATRIX_COLS] / RGB_MATRIX_LED_COUNT;
+}
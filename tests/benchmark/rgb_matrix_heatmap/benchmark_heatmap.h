@@ -0,0 +1,27 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void heatmap_layout_init(void);
+
+/* The key pressed for the given keypress of a typist moving around the board. */
+void heatmap_key(uint32_t keypress, uint8_t *row, uint8_t *col);
+
+/* Builds a list of the keys within the spread of every key, along with the heat they get, from g_led_config. Returns the bytes it takes. */
+uint32_t heatmap_neighbours_init(void);
+
+/* Adds the heat of a keypress to the copy of the frame buffer, from the neighbour lists. */
+void heatmap_press_neighbours(uint8_t row, uint8_t col);
+
+/* Clears the frame buffer and its copy. */
+void heatmap_clear(void);
+
+/* Whether the copy came out the same as the frame buffer of the effect. */
+bool heatmap_buffers_match(void);
+
+/* How many keys a keypress heats up, on average. */
+uint32_t heatmap_neighbours_per_key(void);
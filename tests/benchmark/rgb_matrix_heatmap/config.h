@@ -0,0 +1,17 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// A full size board, with a key of the matrix for every LED
+#undef MATRIX_ROWS
+#undef MATRIX_COLS
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 18
+
+#define RGB_MATRIX_LED_COUNT 104
+#define RGB_MATRIX_KEYPRESSES
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
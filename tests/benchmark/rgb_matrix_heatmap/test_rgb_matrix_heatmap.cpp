@@ -0,0 +1,70 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "benchmark_heatmap.h"
+#include "rgb_matrix.h"
+}
+
+/*
+ * Presses keys of a 104 key board with TYPING_HEATMAP running, and compares
+ * the ways of heating up the keys around each keypress:
+ *
+ * - rgb_matrix_handle_key_event(), which walks every position of the
+ *   matrix for each keypress, as the effect does today.
+ * - A list of the keys within the spread of every key, along with the heat
+ *   they get, built from g_led_config.
+ *
+ * As part of `make test`, a few keys are pressed as a smoke test.
+ * `make benchmark:rgb_matrix_heatmap` presses QMK_BENCHMARK_ITERATIONS keys,
+ * and records the time per keypress as properties of the JSON test report.
+ */
+class RgbMatrixHeatmap : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        heatmap_layout_init();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+
+        for (uint32_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            heatmap_key(i, &keys[i].row, &keys[i].col);
+        }
+    }
+
+    template <typename Press>
+    uint64_t ns_per_keypress(Press press) {
+        heatmap_clear();
+        uint64_t elapsed = time_ns([&] {
+            for (unsigned long i = 0; i < iterations; i++) {
+                press(keys[i % RGB_MATRIX_LED_COUNT].row, keys[i % RGB_MATRIX_LED_COUNT].col);
+            }
+        });
+        return per(elapsed, iterations);
+    }
+
+    /* Every key of the board, in the order they are pressed. */
+    struct {
+        uint8_t row;
+        uint8_t col;
+    } keys[RGB_MATRIX_LED_COUNT];
+};
+
+TEST_F(RgbMatrixHeatmap, NeighbourListKeypress) {
+    record("matrix_walk_ns_per_keypress", ns_per_keypress([](uint8_t row, uint8_t col) { rgb_matrix_handle_key_event(row, col, true); }));
+
+    uint32_t bytes = heatmap_neighbours_init();
+    record("neighbours_ns_per_keypress", ns_per_keypress(heatmap_press_neighbours));
+    record("neighbours_bytes", bytes);
+    record("neighbours_per_key", heatmap_neighbours_per_key());
+
+    // Same heat from both, before the buffer saturates
+    heatmap_clear();
+    for (uint8_t i = 0; i < 8; i++) {
+        rgb_matrix_handle_key_event(keys[i].row, keys[i].col, true);
+        heatmap_press_neighbours(keys[i].row, keys[i].col);
+        EXPECT_GT(g_rgb_frame_buffer[keys[i].row][keys[i].col], 0);
+        ASSERT_TRUE(heatmap_buffers_match());
+    }
+}
@@ -0,0 +1,142 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "benchmark_splash.h"
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+
+/*
+ * A 104 key board laid out on a regular grid over the full 224x64 LED area,
+ * with the test matrix mapped to the keys in the middle of it.
+ */
+static const uint8_t splash_row_lengths[] = {17, 18, 18, 17, 17, 17};
+
+led_config_t g_led_config;
+
+void splash_layout_init(void) {
+    memset(g_led_config.matrix_co, NO_LED, sizeof(g_led_config.matrix_co));
+    uint8_t led = 0;
+    for (uint8_t row = 0; row < ARRAY_SIZE(splash_row_lengths); row++) {
+        for (uint8_t col = 0; col < splash_row_lengths[row]; col++, led++) {
+            g_led_config.point[led] = (led_point_t){.x = col * 224 / 17, .y = row * 64 / 5};
+            g_led_config.flags[led] = LED_FLAG_KEYLIGHT;
+            if (row >= 1 && row <= MATRIX_ROWS && col >= 1 && col <= MATRIX_COLS) {
+                g_led_config.matrix_co[row - 1][col - 1] = led;
+            }
+        }
+    }
+}
+
+_Static_assert(SPLASH_HITS == LED_HITS_TO_REMEMBER, "Every hit is remembered");
+
+bool MULTISPLASH(effect_params_t *params);
+
+void splash_set_hits(uint32_t frame) {
+    g_last_hit_tracker.count = SPLASH_HITS;
+    for (uint8_t j = 0; j < SPLASH_HITS; j++) {
+        uint32_t key                = (frame + j) * 7919 % (MATRIX_ROWS * MATRIX_COLS);
+        uint8_t  led                = g_led_config.matrix_co[key / MATRIX_COLS][key % MATRIX_COLS];
+        g_last_hit_tracker.index[j] = led;
+        g_last_hit_tracker.x[j]     = g_led_config.point[led].x;
+        g_last_hit_tracker.y[j]     = g_led_config.point[led].y;
+        g_last_hit_tracker.tick[j]  = (SPLASH_HITS - j) * 60;
+    }
+}
+
+void splash_render_frame(void) {
+    effect_params_t params = {.iter = 0, .flags = LED_FLAG_ALL, .init = false};
+    MULTISPLASH(&params);
+}
+
+uint32_t splash_leds_set;
+
+static void splash_init(void) {}
+
+static void splash_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    splash_leds_set++;
+}
+
+static void splash_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void splash_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = splash_init,
+    .set_color     = splash_set_color,
+    .set_color_all = splash_set_color_all,
+    .flush         = splash_flush,
+};
+
+static uint8_t splash_sqrt_distances[RGB_MATRIX_LED_COUNT][SPLASH_HITS];
+static uint8_t splash_neighbour_distances[RGB_MATRIX_LED_COUNT][SPLASH_HITS];
+
+void splash_distances_sqrt(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+            int16_t dx                  = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy                  = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            splash_sqrt_distances[i][j] = sqrt16(dx * dx + dy * dy);
+        }
+    }
+}
+
+static struct {
+    uint8_t index[SPLASH_NEIGHBOURS_MAX];
+    uint8_t distance[SPLASH_NEIGHBOURS_MAX];
+} splash_neighbours[RGB_MATRIX_LED_COUNT];
+static uint8_t splash_neighbour_count;
+
+static uint8_t splash_led_distance(uint8_t a, uint8_t b) {
+    int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+    int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+void splash_neighbours_init(uint8_t count) {
+    splash_neighbour_count = count;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        // Insertion sort of the nearest LEDs seen so far, the LED itself included
+        uint8_t found = 0;
+        for (uint8_t n = 0; n < RGB_MATRIX_LED_COUNT; n++) {
+            uint8_t distance = splash_led_distance(i, n);
+            uint8_t slot     = found < count ? found++ : count;
+            while (slot > 0 && splash_neighbours[i].distance[slot - 1] > distance) {
+                if (slot < count) {
+                    splash_neighbours[i].index[slot]    = splash_neighbours[i].index[slot - 1];
+                    splash_neighbours[i].distance[slot] = splash_neighbours[i].distance[slot - 1];
+                }
+                slot--;
+            }
+            if (slot < count) {
+                splash_neighbours[i].index[slot]    = n;
+                splash_neighbours[i].distance[slot] = distance;
+            }
+        }
+    }
+}
+
+uint32_t splash_distances_neighbours(void) {
+    uint32_t found = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+            uint8_t n = 0;
+            while (n < splash_neighbour_count && splash_neighbours[i].index[n] != g_last_hit_tracker.index[j]) {
+                n++;
+            }
+            if (n < splash_neighbour_count) {
+                splash_neighbour_distances[i][j] = splash_neighbours[i].distance[n];
+                found++;
+            } else {
+                int16_t dx                       = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+                int16_t dy                       = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+                splash_neighbour_distances[i][j] = sqrt16(dx * dx + dy * dy);
+            }
+        }
+    }
+    return found;
+}
+
+bool splash_distances_match(void) {
+    return memcmp(splash_sqrt_distances, splash_neighbour_distances, sizeof(splash_sqrt_distances)) == 0;
+}
@@ -0,0 +1,34 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Every hit remembered, as when typing steadily
+#define SPLASH_HITS 8
+
+#define SPLASH_NEIGHBOURS_MAX 16
+
+extern uint32_t splash_leds_set;
+
+void splash_layout_init(void);
+
+/* Sets the hits of the eight most recent keys of a typist moving around the matrix, a different set for each frame. */
+void splash_set_hits(uint32_t frame);
+
+/* Renders MULTISPLASH for every LED. */
+void splash_render_frame(void);
+
+/* Distances from every LED to every hit, computed the way the splash runner does. */
+void splash_distances_sqrt(void);
+
+/* Builds a list of the `count` nearest LEDs of every LED, along with their distances, from g_led_config. */
+void splash_neighbours_init(uint8_t count);
+
+/* The same distances, looked up in the neighbour lists where possible. Returns how many were found there. */
+uint32_t splash_distances_neighbours(void);
+
+/* Whether both ways came up with the same distances. */
+bool splash_distances_match(void);
@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// A full size board, with LEDs for the keys beyond the test matrix
+#define RGB_MATRIX_LED_COUNT 104
+#define RGB_MATRIX_KEYPRESSES
+#define ENABLE_RGB_MATRIX_SOLID_MULTISPLASH
+#define ENABLE_RGB_MATRIX_MULTISPLASH
+
+// Every LED is rendered in one go
+#define RGB_MATRIX_LED_PROCESS_LIMIT 0
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "benchmark_splash.h"
+}
+
+/*
+ * Renders frames of MULTISPLASH on a 104 LED board with all eight hits
+ * remembered, as when typing steadily, and compares the ways of getting the
+ * distance between each LED and each hit:
+ *
+ * - sqrt16() of the squared distance, as effect_runner_reactive_splash()
+ *   does for every LED and hit of every frame.
+ * - A list of the K nearest LEDs of every LED built from g_led_config, with
+ *   sqrt16() as the fallback for hits further away.
+ *
+ * The splash ring of a hit travels out to a distance of 255 before fading,
+ * so every LED needs the distance to every hit, and a bounded list can only
+ * answer for the hits among an LED's nearest neighbours.
+ *
+ * As part of `make test`, a few frames are rendered as a smoke test.
+ * `make benchmark:rgb_matrix_splash` renders QMK_BENCHMARK_ITERATIONS frames,
+ * and records the time per frame as properties of the JSON test report.
+ */
+class RgbMatrixSplash : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        splash_layout_init();
+    }
+
+    template <typename Frame>
+    uint64_t ns_per_frame(Frame frame) {
+        uint64_t elapsed = time_ns([&] {
+            for (unsigned long i = 0; i < iterations; i++) {
+                splash_set_hits(i);
+                frame();
+            }
+        });
+        return per(elapsed, iterations);
+    }
+};
+
+TEST_F(RgbMatrixSplash, NeighbourListDistances) {
+    splash_leds_set = 0;
+    record("multisplash_ns_per_frame", ns_per_frame(splash_render_frame));
+    EXPECT_EQ(splash_leds_set, iterations * RGB_MATRIX_LED_COUNT);
+
+    record("sqrt16_ns_per_frame", ns_per_frame(splash_distances_sqrt));
+
+    for (uint8_t count : {4, 8, 16}) {
+        splash_neighbours_init(count);
+        uint64_t found = 0;
+        uint64_t ns    = ns_per_frame([&] { found += splash_distances_neighbours(); });
+
+        // Same distances as the square roots
+        for (unsigned long i = 0; i < iterations; i++) {
+            splash_set_hits(i);
+            splash_distances_sqrt();
+            splash_distances_neighbours();
+            ASSERT_TRUE(splash_distances_match());
+        }
+
+        std::string name = "neighbours_" + std::to_string(count);
+        record(name + "_ns_per_frame", ns);
+        record(name + "_bytes", 2 * count * RGB_MATRIX_LED_COUNT);
+        record(name + "_found_percent", per(found * 100, iterations * RGB_MATRIX_LED_COUNT * SPLASH_HITS));
+    }
+}
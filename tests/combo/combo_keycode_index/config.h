@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+#define COMBO_KEYCODE_INDEX_SIZE 16
+// Few buckets so that unrelated combos and keys of the same combo collide
+#define COMBO_KEYCODE_INDEX_BUCKETS 4
@@ -0,0 +1,21 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { ab_combo, ae_combo, abc_combo, jk_combo };
+
+// KC_A and KC_E share a bucket, as do KC_B and KC_J
+uint16_t const ab[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const ae[]  = {KC_A, KC_E, COMBO_END};
+uint16_t const abc[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const jk[]  = {KC_J, KC_K, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_combo]  = COMBO(ab, KC_X),
+    [ae_combo]  = COMBO(ae, KC_Y),
+    [abc_combo] = COMBO(abc, KC_Z),
+    [jk_combo]  = COMBO(jk, KC_ESCAPE)
+};
+// clang-format on
@@ -0,0 +1,151 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct invocation_t {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+};
+
+static std::vector<invocation_t> invocations;
+static uint32_t                  start_time = 0;
+
+struct executor_arg_t {
+    int      id;
+    uint32_t repeat_ms;
+    int      remaining_repeats;
+};
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    executor_arg_t *arg = (executor_arg_t *)cb_arg;
+    invocations.push_back({arg->id, trigger_time - start_time, timer_read32() - start_time});
+    if (arg->remaining_repeats > 0) {
+        arg->remaining_repeats--;
+        return arg->repeat_ms;
+    }
+    return 0;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    void SetUp() override {
+        invocations.clear();
+        // The fixture rewinds the timer, but deferred execution throttles on the last execution time. Keep time
+        // moving forward across tests instead.
+        start_time += 100000;
+        set_time(start_time);
+    }
+
+    void run_deferred_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            deferred_exec_task();
+            advance_time(1);
+        }
+    }
+};
+
+TEST_F(DeferredExec, ExecutesInDeadlineOrder) {
+    executor_arg_t a = {1, 0, 0}, b = {2, 0, 0}, c = {3, 0, 0};
+
+    EXPECT_NE(defer_exec(30, record_callback, &a), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec(10, record_callback, &b), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec(20, record_callback, &c), INVALID_DEFERRED_TOKEN);
+
+    uint32_t next = 0;
+    EXPECT_TRUE(deferred_exec_next_trigger(&next));
+    EXPECT_EQ(next - start_time, 10);
+
+    run_deferred_for(40);
+
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[0].id, 2);
+    EXPECT_EQ(invocations[0].now, 10);
+    EXPECT_EQ(invocations[1].id, 3);
+    EXPECT_EQ(invocations[1].now, 20);
+    EXPECT_EQ(invocations[2].id, 1);
+    EXPECT_EQ(invocations[2].now, 30);
+    EXPECT_FALSE(deferred_exec_next_trigger(&next));
+}
+
+TEST_F(DeferredExec, RequeueIsRelativeToTriggerTime) {
+    executor_arg_t a = {1, 25, 3};
+
+    EXPECT_NE(defer_exec(10, record_callback, &a), INVALID_DEFERRED_TOKEN);
+
+    // Execution is late, the repeats still keep the original cadence
+    advance_time(15);
+    run_deferred_for(100);
+
+    ASSERT_EQ(invocations.size(), 4);
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    EXPECT_EQ(invocations[0].now, 15);
+    EXPECT_EQ(invocations[1].trigger_time, 35);
+    EXPECT_EQ(invocations[1].now, 35);
+    EXPECT_EQ(invocations[2].trigger_time, 60);
+    EXPECT_EQ(invocations[3].trigger_time, 85);
+
+    uint32_t next = 0;
+    EXPECT_FALSE(deferred_exec_next_trigger(&next));
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    executor_arg_t a = {1, 0, 0}, b = {2, 0, 0};
+
+    deferred_token token_a = defer_exec(10, record_callback, &a);
+    deferred_token token_b = defer_exec(20, record_callback, &b);
+    EXPECT_NE(token_a, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(token_b, INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec(token_a));
+    EXPECT_FALSE(cancel_deferred_exec(token_a));
+
+    run_deferred_for(15);
+    EXPECT_TRUE(invocations.empty());
+
+    // Extending can also shorten the remaining delay
+    EXPECT_TRUE(extend_deferred_exec(token_b, 2));
+    uint32_t next = 0;
+    EXPECT_TRUE(deferred_exec_next_trigger(&next));
+    EXPECT_EQ(next - start_time, 17);
+
+    run_deferred_for(10);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].id, 2);
+    EXPECT_EQ(invocations[0].now, 17);
+    EXPECT_FALSE(extend_deferred_exec(token_b, 10));
+}
+
+TEST_F(DeferredExec, TableFullReturnsInvalidToken) {
+    executor_arg_t args[MAX_DEFERRED_EXECUTORS + 1];
+    deferred_token tokens[MAX_DEFERRED_EXECUTORS];
+
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        args[i]   = {i, 0, 0};
+        tokens[i] = defer_exec(100 + i, record_callback, &args[i]);
+        EXPECT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+    }
+    args[MAX_DEFERRED_EXECUTORS] = {MAX_DEFERRED_EXECUTORS, 0, 0};
+    EXPECT_EQ(defer_exec(50, record_callback, &args[MAX_DEFERRED_EXECUTORS]), INVALID_DEFERRED_TOKEN);
+
+    // A failed registration must not wake the scheduler early
+    uint32_t next = 0;
+    EXPECT_TRUE(deferred_exec_next_trigger(&next));
+    EXPECT_EQ(next - start_time, 100);
+
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_TRUE(cancel_deferred_exec(tokens[i]));
+    }
+    run_deferred_for(200);
+    EXPECT_TRUE(invocations.empty());
+    EXPECT_FALSE(deferred_exec_next_trigger(&next));
+}
@@ -0,0 +1,38 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <string.h>
+#include "eeprom_driver.h"
+#include "mock_eeprom.h"
+
+static uint8_t mock_eeprom[EEPROM_SIZE];
+size_t         mock_read_transactions;
+size_t         mock_write_transactions;
+
+void eeprom_driver_init(void) {}
+
+void eeprom_driver_erase(void) {
+    memset(mock_eeprom, 0, sizeof(mock_eeprom));
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    memcpy(buf, &mock_eeprom[(uintptr_t)addr], len);
+    mock_read_transactions++;
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src    = (const uint8_t *)buf;
+    uintptr_t      target = (uintptr_t)addr;
+    while (len > 0) {
+        size_t chunk = MOCK_EEPROM_PAGE_SIZE - (target % MOCK_EEPROM_PAGE_SIZE);
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(&mock_eeprom[target], src, chunk);
+        mock_write_transactions++;
+        src += chunk;
+        target += chunk;
+        len -= chunk;
+    }
+}
@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+
+/* Mock external EEPROM with 32-byte pages, counting bus transactions the same way as the I2C and SPI drivers issue them. */
+#define MOCK_EEPROM_PAGE_SIZE 32
+
+extern size_t mock_read_transactions;
+extern size_t mock_write_transactions;
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 1024
+#define EEPROM_UPDATE_BLOCK_CHUNK_SIZE 32
+#define DYNAMIC_KEYMAP_RAM_MIRROR_ENABLE
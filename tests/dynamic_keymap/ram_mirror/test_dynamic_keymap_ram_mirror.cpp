@@ -0,0 +1,89 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "eeprom.h"
+#include "../mock_eeprom.h"
+}
+
+static constexpr uint16_t keymap_size = 4 * MATRIX_ROWS * MATRIX_COLS * 2;
+
+class DynamicKeymapRamMirror : public TestFixture {
+   protected:
+    void SetUp() override {
+        mock_read_transactions  = 0;
+        mock_write_transactions = 0;
+    }
+
+    /* Reads the keymap straight from EEPROM, bypassing the mirror. */
+    std::vector<uint8_t> eeprom_contents(void) {
+        std::vector<uint8_t> keymap(keymap_size);
+        eeprom_read_block(keymap.data(), dynamic_keymap_key_to_eeprom_address(0, 0, 0), keymap.size());
+        return keymap;
+    }
+
+    std::vector<uint8_t> mirror_contents(void) {
+        std::vector<uint8_t> keymap(keymap_size);
+        dynamic_keymap_get_buffer(0, keymap.size(), keymap.data());
+        return keymap;
+    }
+};
+
+TEST_F(DynamicKeymapRamMirror, eeprom_reads_per_1000_key_events) {
+    /* Base layer of KC_A underneath a fully transparent layer. */
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            dynamic_keymap_set_keycode(0, row, col, KC_A);
+            dynamic_keymap_set_keycode(1, row, col, KC_TRNS);
+        }
+    }
+    mock_read_transactions = 0;
+
+    /* Resolve each key event top-down through layers 1 and 0, the way action_layer does. */
+    for (uint16_t event = 0; event < 1000; event++) {
+        uint8_t  row     = event % MATRIX_ROWS;
+        uint8_t  col     = (event / MATRIX_ROWS) % MATRIX_COLS;
+        uint16_t keycode = KC_TRNS;
+        for (int8_t layer = 1; layer >= 0 && keycode == KC_TRNS; layer--) {
+            keycode = keycode_at_keymap_location(layer, row, col);
+        }
+        EXPECT_EQ(keycode, KC_A);
+    }
+
+    /* The mirror was loaded by keyboard_init(), so lookups never touch EEPROM. */
+    RecordProperty("eeprom_reads_per_1000_key_events", mock_read_transactions);
+    EXPECT_EQ(mock_read_transactions, 0);
+}
+
+TEST_F(DynamicKeymapRamMirror, set_keycode_writes_through) {
+    dynamic_keymap_set_keycode(2, 1, 3, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 1, 3), KC_B);
+    EXPECT_GT(mock_write_transactions, 0);
+
+    dynamic_keymap_set_keycode(2, 1, 3, LCTL(KC_C));
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 1, 3), LCTL(KC_C));
+    EXPECT_EQ(eeprom_contents(), mirror_contents());
+}
+
+TEST_F(DynamicKeymapRamMirror, set_buffer_writes_through) {
+    std::vector<uint8_t> keymap(keymap_size);
+    std::iota(keymap.begin(), keymap.end(), 0x40);
+    for (uint16_t offset = 0; offset < keymap.size(); offset += 28) {
+        dynamic_keymap_set_buffer(offset, std::min<uint16_t>(28, keymap.size() - offset), &keymap[offset]);
+    }
+
+    mock_read_transactions = 0;
+    EXPECT_EQ(mirror_contents(), keymap);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, MATRIX_ROWS - 1, MATRIX_COLS - 1), (uint16_t)(keymap[keymap_size - 2] << 8 | keymap[keymap_size - 1]));
+    EXPECT_EQ(mock_read_transactions, 0);
+
+    EXPECT_EQ(eeprom_contents(), keymap);
+}
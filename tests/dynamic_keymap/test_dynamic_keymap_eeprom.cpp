@@ -0,0 +1,156 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "mock_eeprom.h"
+}
+
+/* VIA transfers the keymap in chunks of at most 28 bytes. */
+static constexpr uint16_t via_chunk_size = 28;
+static constexpr uint16_t keymap_size    = 4 * MATRIX_ROWS * MATRIX_COLS * 2;
+
+class DynamicKeymapEeprom : public TestFixture {
+   protected:
+    void SetUp() override {
+        mock_read_transactions  = 0;
+        mock_write_transactions = 0;
+    }
+
+    std::vector<uint8_t> generate_keymap(uint8_t seed) {
+        std::vector<uint8_t> keymap(keymap_size);
+        std::iota(keymap.begin(), keymap.end(), seed);
+        return keymap;
+    }
+
+    /* Base layer of KC_A underneath a fully transparent layer. */
+    std::vector<uint8_t> generate_layered_keymap(void) {
+        std::vector<uint8_t> keymap(keymap_size, 0);
+        for (uint16_t i = 0; i < MATRIX_ROWS * MATRIX_COLS; i++) {
+            keymap[i * 2 + 1]                               = KC_A;
+            keymap[(MATRIX_ROWS * MATRIX_COLS + i) * 2 + 1] = KC_TRNS;
+        }
+        return keymap;
+    }
+
+    void upload(const std::vector<uint8_t> &keymap) {
+        for (uint16_t offset = 0; offset < keymap.size(); offset += via_chunk_size) {
+            uint16_t size = std::min<uint16_t>(via_chunk_size, keymap.size() - offset);
+            dynamic_keymap_set_buffer(offset, size, const_cast<uint8_t *>(&keymap[offset]));
+        }
+    }
+
+    std::vector<uint8_t> dump(void) {
+        std::vector<uint8_t> keymap(keymap_size);
+        for (uint16_t offset = 0; offset < keymap.size(); offset += via_chunk_size) {
+            uint16_t size = std::min<uint16_t>(via_chunk_size, keymap.size() - offset);
+            dynamic_keymap_get_buffer(offset, size, &keymap[offset]);
+        }
+        return keymap;
+    }
+};
+
+TEST_F(DynamicKeymapEeprom, keymap_dump_uses_one_read_per_chunk) {
+    auto   keymap = dump();
+    size_t chunks = (keymap_size + via_chunk_size - 1) / via_chunk_size;
+
+    /* Previously, every byte was a separate read transaction. */
+    EXPECT_EQ(mock_read_transactions, chunks);
+    EXPECT_EQ(mock_write_transactions, 0);
+}
+
+TEST_F(DynamicKeymapEeprom, keymap_upload_writes_whole_pages) {
+    auto keymap = generate_keymap(0x10);
+    upload(keymap);
+
+    /* Each chunk is compared and written per page, so at most two reads and writes for each VIA chunk. */
+    size_t chunks = (keymap_size + via_chunk_size - 1) / via_chunk_size;
+    EXPECT_LE(mock_read_transactions, chunks * 2);
+    EXPECT_LE(mock_write_transactions, chunks * 2);
+    EXPECT_GT(mock_write_transactions, 0);
+
+    EXPECT_EQ(dump(), keymap);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), (uint16_t)(keymap[0] << 8 | keymap[1]));
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, MATRIX_ROWS - 1, MATRIX_COLS - 1), (uint16_t)(keymap[keymap_size - 2] << 8 | keymap[keymap_size - 1]));
+}
+
+TEST_F(DynamicKeymapEeprom, keymap_upload_skips_unchanged_pages) {
+    auto keymap = generate_keymap(0x20);
+    upload(keymap);
+    mock_write_transactions = 0;
+
+    /* Uploading the same keymap again doesn't write anything. */
+    upload(keymap);
+    EXPECT_EQ(mock_write_transactions, 0);
+
+    /* Changing a single keycode only rewrites the page it lives in. */
+    keymap[100] ^= 0xFF;
+    upload(keymap);
+    EXPECT_EQ(mock_write_transactions, 1);
+    EXPECT_EQ(dump(), keymap);
+}
+
+TEST_F(DynamicKeymapEeprom, buffer_access_is_clamped_to_keymap) {
+    auto keymap = generate_keymap(0x30);
+    upload(keymap);
+
+    /* Reads past the end of the keymap are zero-filled. */
+    std::array<uint8_t, 8> buffer;
+    buffer.fill(0xAA);
+    dynamic_keymap_get_buffer(keymap_size - 4, buffer.size(), buffer.data());
+    EXPECT_EQ(buffer[0], keymap[keymap_size - 4]);
+    EXPECT_EQ(buffer[3], keymap[keymap_size - 1]);
+    EXPECT_EQ(buffer[4], 0);
+    EXPECT_EQ(buffer[7], 0);
+
+    /* Writes past the end of the keymap leave the macro buffer untouched. */
+    std::array<uint8_t, 8> macros_before, macros_after;
+    dynamic_keymap_macro_get_buffer(0, macros_before.size(), macros_before.data());
+    buffer.fill(0x55);
+    dynamic_keymap_set_buffer(keymap_size - 4, buffer.size(), buffer.data());
+    dynamic_keymap_macro_get_buffer(0, macros_after.size(), macros_after.data());
+    EXPECT_EQ(macros_before, macros_after);
+}
+
+TEST_F(DynamicKeymapEeprom, macro_buffer_round_trip) {
+    std::vector<uint8_t> macros(100);
+    std::iota(macros.begin(), macros.end(), 1);
+    dynamic_keymap_macro_set_buffer(0, macros.size(), macros.data());
+
+    mock_read_transactions = 0;
+    std::vector<uint8_t> readback(macros.size());
+    dynamic_keymap_macro_get_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, macros);
+    EXPECT_EQ(mock_read_transactions, 1);
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_get_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, std::vector<uint8_t>(macros.size(), 0));
+}
+
+TEST_F(DynamicKeymapEeprom, eeprom_reads_per_1000_key_events) {
+    upload(generate_layered_keymap());
+    mock_read_transactions = 0;
+
+    /* Resolve each key event top-down through layers 1 and 0, the way action_layer does. */
+    for (uint16_t event = 0; event < 1000; event++) {
+        uint8_t  row     = event % MATRIX_ROWS;
+        uint8_t  col     = (event / MATRIX_ROWS) % MATRIX_COLS;
+        uint16_t keycode = KC_TRNS;
+        for (int8_t layer = 1; layer >= 0 && keycode == KC_TRNS; layer--) {
+            keycode = keycode_at_keymap_location(layer, row, col);
+        }
+        EXPECT_EQ(keycode, KC_A);
+    }
+
+    /* Every lookup reads both bytes of the keycode from EEPROM. */
+    RecordProperty("eeprom_reads_per_1000_key_events", mock_read_transactions);
+    EXPECT_EQ(mock_read_transactions, 1000 * 2 * 2);
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// 64 byte pages, from the part's defaults in eeprom_i2c.h
+#define EEPROM_I2C_24LC256
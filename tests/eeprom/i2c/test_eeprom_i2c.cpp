@@ -0,0 +1,102 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_i2c.h"
+#include "i2c_master.h"
+}
+
+static_assert(EXTERNAL_EEPROM_PAGE_SIZE == 64, "The 24LC256 has 64 byte pages");
+
+/*
+ * Mock 24xx EEPROM on the I2C stand-in. Each write starts with the address,
+ * followed by the data to write, which can't cross a page boundary. A write
+ * of just the address sets where the next read starts.
+ */
+static uint8_t                                   eeprom_contents[EXTERNAL_EEPROM_BYTE_COUNT];
+static uint16_t                                  eeprom_pointer;
+static std::vector<std::pair<uint16_t, uint16_t>> eeprom_page_writes;
+
+static i2c_status_t eeprom_receive(uint8_t address, const uint8_t *data, uint16_t length) {
+    eeprom_pointer = (data[0] << 8) | data[1];
+    length -= EXTERNAL_EEPROM_ADDRESS_SIZE;
+    if (length > 0) {
+        EXPECT_LE(eeprom_pointer % EXTERNAL_EEPROM_PAGE_SIZE + length, EXTERNAL_EEPROM_PAGE_SIZE) << "Write crosses a page boundary";
+        memcpy(&eeprom_contents[eeprom_pointer], &data[EXTERNAL_EEPROM_ADDRESS_SIZE], length);
+        eeprom_page_writes.emplace_back(eeprom_pointer, length);
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+static i2c_status_t eeprom_send(uint8_t address, uint8_t *data, uint16_t length) {
+    memcpy(data, &eeprom_contents[eeprom_pointer], length);
+    eeprom_pointer += length;
+    return I2C_STATUS_SUCCESS;
+}
+
+class EepromI2c : public TestFixture {
+   protected:
+    void SetUp() override {
+        i2c_test_attach(eeprom_receive);
+        i2c_test_attach_source(eeprom_send);
+
+        for (uint16_t i = 0; i < sizeof(eeprom_contents); i++) {
+            eeprom_contents[i] = i * 7;
+        }
+        eeprom_page_writes.clear();
+    }
+
+    void TearDown() override {
+        i2c_test_attach(NULL);
+        i2c_test_attach_source(NULL);
+    }
+
+    /* The current contents of `len` bytes from `addr`, as a block to update them with. */
+    std::vector<uint8_t> block(uint16_t addr, uint16_t len) {
+        return std::vector<uint8_t>(&eeprom_contents[addr], &eeprom_contents[addr + len]);
+    }
+};
+
+TEST_F(EepromI2c, update_block_writes_each_changed_page_once) {
+    std::vector<uint8_t> data = block(0, 256);
+    // Both halves of the first page, and the third page
+    data[1] ^= 0xFF;
+    data[40] ^= 0xFF;
+    data[130] ^= 0xFF;
+
+    eeprom_update_block(data.data(), (void *)0, data.size());
+
+    std::vector<std::pair<uint16_t, uint16_t>> expected = {{0, 64}, {128, 64}};
+    EXPECT_EQ(eeprom_page_writes, expected);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), eeprom_contents));
+}
+
+TEST_F(EepromI2c, update_block_writes_nothing_when_unchanged) {
+    std::vector<uint8_t> data = block(0, 256);
+
+    eeprom_update_block(data.data(), (void *)0, data.size());
+
+    EXPECT_TRUE(eeprom_page_writes.empty());
+}
+
+TEST_F(EepromI2c, unaligned_update_block_stays_within_pages) {
+    std::vector<uint8_t> data = block(100, 100);
+    // The partial first page, and the last byte of the update in the partial last page
+    data[0] ^= 0xFF;
+    data[50] ^= 0xFF;
+    data[99] ^= 0xFF;
+
+    eeprom_update_block(data.data(), (void *)100, data.size());
+
+    std::vector<std::pair<uint16_t, uint16_t>> expected = {{100, 28}, {128, 64}, {192, 8}};
+    EXPECT_EQ(eeprom_page_writes, expected);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), &eeprom_contents[100]));
+}
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define LAYER_RESOLUTION_CACHE_ENABLE
+// Only cache half of the test matrix to exercise the uncached fallback as well
+#define LAYER_RESOLUTION_CACHE_KEYS ((MATRIX_ROWS * MATRIX_COLS) / 2)
@@ -0,0 +1,112 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+#define TEST_LAYER_COUNT 4
+
+class LayerResolutionCache : public TestFixture {
+   protected:
+    /* Maps every key on every test layer, with a different pattern of transparent keys per layer. */
+    void populate_keymap() {
+        for (layer_t layer = 0; layer < TEST_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    bool transparent = layer > 0 && ((row + col + layer) % (layer + 1)) != 0;
+                    add_key(KeymapKey(layer, col, row, transparent ? KC_TRNS : KC_A + layer));
+                }
+            }
+        }
+    }
+
+    /* Uncached reference implementation of layer_switch_get_layer. */
+    uint8_t reference_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && keymap_key_to_keycode(i, key) != KC_TRNS) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void expect_all_keys_match_reference() {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                EXPECT_EQ(layer_switch_get_layer(key), reference_layer(key)) << "col " << +col << " row " << +row;
+            }
+        }
+    }
+};
+
+TEST_F(LayerResolutionCache, MatchesUncachedLookupForAllLayerStates) {
+    TestDriver    driver;
+    layer_state_t saved_default_layer_state = default_layer_state;
+
+    populate_keymap();
+
+    EXPECT_NO_REPORT(driver);
+    for (layer_state_t default_state = 1; default_state < (1 << TEST_LAYER_COUNT); default_state <<= 1) {
+        default_layer_set(default_state);
+        for (layer_state_t state = 0; state < (1 << TEST_LAYER_COUNT); state++) {
+            layer_state_set(state);
+            /* Once to populate the cache, once to read it back. */
+            expect_all_keys_match_reference();
+            expect_all_keys_match_reference();
+        }
+    }
+
+    default_layer_set(saved_default_layer_state);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, DirectLayerStateAssignmentIsDetected) {
+    TestDriver driver;
+    keypos_t   key = {.col = 1, .row = 0};
+
+    populate_keymap();
+
+    EXPECT_NO_REPORT(driver);
+    layer_state_set(0);
+    EXPECT_EQ(layer_switch_get_layer(key), reference_layer(key));
+
+    /* Bypass layer_state_set, the cache must still notice the new state. */
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key), 1);
+    EXPECT_EQ(layer_switch_get_layer(key), reference_layer(key));
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, KeymapChangeClearsCache) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b   = KeymapKey(1, 0, 0, KC_B);
+    auto       key_trn = KeymapKey(1, 0, 0, KC_TRNS);
+
+    set_keymap({key_a, key_b});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    /* Same layer state, but the upper layer is transparent now. */
+    set_keymap({key_a, key_trn});
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
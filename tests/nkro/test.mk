@@ -0,0 +1 @@
+NKRO_ENABLE = yes
@@ -0,0 +1,100 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class Nkro : public TestFixture {};
+
+TEST_F(Nkro, PressedKeysAreTracked) {
+    TestDriver driver;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_f12 = KeymapKey(0, 1, 0, KC_F12);
+    auto       key_rsh = KeymapKey(0, 2, 0, KC_RIGHT_SHIFT);
+
+    set_keymap({key_a, key_f12, key_rsh});
+    EXPECT_CALL(driver, send_nkro_mock(_)).Times(testing::AnyNumber());
+
+    key_f12.press();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    key_rsh.press();
+    run_one_scan_loop();
+
+    /* Modifiers don't count as keys */
+    EXPECT_EQ(has_anykey(), 2);
+    EXPECT_EQ(get_first_key(), KC_A);
+    EXPECT_TRUE(is_key_pressed(KC_A));
+    EXPECT_TRUE(is_key_pressed(KC_F12));
+    EXPECT_FALSE(is_key_pressed(KC_B));
+
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EQ(has_anykey(), 1);
+    EXPECT_EQ(get_first_key(), KC_F12);
+
+    key_f12.release();
+    key_rsh.release();
+    run_one_scan_loop();
+    EXPECT_EQ(has_anykey(), 0);
+    EXPECT_EQ(get_first_key(), KC_NO);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Nkro, ReportLayoutIsUnchanged) {
+    TestDriver    driver;
+    auto          key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto          key_f24 = KeymapKey(0, 1, 0, KC_F24);
+    report_nkro_t sent    = {};
+
+    set_keymap({key_a, key_f24});
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillRepeatedly(Invoke([&sent](report_nkro_t &report) { sent = report; }));
+
+    key_a.press();
+    key_f24.press();
+    run_one_scan_loop();
+
+    /* One bit per keycode, starting at bit 0 of the byte after the modifiers */
+    uint8_t expected[sizeof(report_nkro_t)] = {REPORT_ID_NKRO, 0};
+    expected[2 + (KC_A >> 3)] |= 1 << (KC_A & 7);
+    expected[2 + (KC_F24 >> 3)] |= 1 << (KC_F24 & 7);
+    EXPECT_EQ(memcmp(&sent, expected, sizeof(expected)), 0);
+
+    key_a.release();
+    key_f24.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Nkro, KeyCountMatchesBitmap) {
+    /* Walk every keycode in the bitmap, pressing some keys twice, and releasing keys that aren't pressed */
+    for (uint16_t code = 1; code < NKRO_REPORT_BITS * 8; code++) {
+        add_key_to_report(code);
+        if (code % 3 == 0) {
+            add_key_to_report(code);
+        }
+        if (code % 5 == 0) {
+            del_key_from_report(code);
+            del_key_from_report(code);
+        }
+        if (code % 7 == 0) {
+            del_key_from_report(code - 1);
+        }
+        ASSERT_EQ(has_anykey(), count_key_bits(nkro_report)) << "keycode " << code;
+    }
+    EXPECT_EQ(get_first_key(), 1);
+
+    for (uint16_t code = 1; code < NKRO_REPORT_BITS * 8; code++) {
+        EXPECT_EQ(is_key_pressed(code), code % 5 != 0 && (code + 1) % 7 != 0) << "keycode " << code;
+    }
+
+    clear_keys_from_report();
+    EXPECT_EQ(has_anykey(), 0);
+    EXPECT_EQ(count_key_bits(nkro_report), 0);
+}
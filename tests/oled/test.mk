@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+OLED_ENABLE = yes
+
+# The OLED is driven through the test platform's I2C stand-in
+SRC += i2c_master.c
@@ -0,0 +1,281 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+#include "oled_driver.h"
+
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+/*
+ * Stand-in for a 128x32 SSD1306 on the test platform's I2C bus. Commands are
+ * decoded just far enough to follow the addressing window, and data is
+ * written to the display memory the way the controller does in horizontal
+ * addressing mode, so the memory can be compared against the driver's buffer.
+ */
+static struct {
+    uint8_t memory[8][128];
+    uint8_t start_column, end_column, column;
+    uint8_t start_page, end_page, page;
+} display;
+
+static uint8_t command_arguments(uint8_t command) {
+    switch (command) {
+        case 0x21: // COLUMN_ADDR
+        case 0x22: // PAGE_ADDR
+            return 2;
+        case 0x26: // SCROLL_RIGHT
+        case 0x27: // SCROLL_LEFT
+            return 6;
+        case 0x20: // MEMORY_MODE
+        case 0x23: // FADE_BLINK
+        case 0x81: // CONTRAST
+        case 0x8D: // CHARGE_PUMP
+        case 0xA8: // MULTIPLEX_RATIO
+        case 0xD3: // DISPLAY_OFFSET
+        case 0xD5: // DISPLAY_CLOCK
+        case 0xD9: // PRE_CHARGE_PERIOD
+        case 0xDA: // COM_PINS
+        case 0xDB: // VCOM_DETECT
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static i2c_status_t display_receive(uint8_t address, const uint8_t *data, uint16_t length) {
+    EXPECT_EQ(address, OLED_DISPLAY_ADDRESS << 1);
+    if (data[0] == 0x40) {
+        for (uint16_t i = 1; i < length; i++) {
+            display.memory[display.page][display.column] = data[i];
+            if (display.column++ == display.end_column) {
+                display.column = display.start_column;
+                if (display.page++ == display.end_page) {
+                    display.page = display.start_page;
+                }
+            }
+        }
+        return I2C_STATUS_SUCCESS;
+    }
+
+    EXPECT_EQ(data[0], 0x00);
+    for (uint16_t i = 1; i < length; i += 1 + command_arguments(data[i])) {
+        EXPECT_LT(i + command_arguments(data[i]), length);
+        if (data[i] == 0x21) {
+            display.start_column = display.column = data[i + 1];
+            display.end_column                    = data[i + 2];
+        } else if (data[i] == 0x22) {
+            display.start_page = display.page = data[i + 1];
+            display.end_page                  = data[i + 2];
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+/*
+ * A typical split keyboard status screen, with the layer, WPM, modifiers and
+ * caps lock, laid out for a landscape display or a portrait one.
+ */
+static struct {
+    bool     portrait;
+    uint8_t  layer;
+    uint16_t wpm;
+    uint8_t  mods;
+    bool     caps;
+} status;
+
+bool oled_task_user(void) {
+    static const char *const layer_names[] = {"Base ", "Lower", "Raise", "Adjst"};
+
+    char wpm[4];
+    snprintf(wpm, sizeof(wpm), "%03u", status.wpm);
+
+    if (!status.portrait) {
+        oled_write("Layer: ", false);
+        oled_write_ln(layer_names[status.layer], false);
+        oled_write("WPM: ", false);
+        oled_write_ln(wpm, false);
+        oled_write("CTL", status.mods & 1);
+        oled_write(" ", false);
+        oled_write("SFT", status.mods & 2);
+        oled_write(" ", false);
+        oled_write("ALT", status.mods & 4);
+        oled_write(" ", false);
+        oled_write_ln("GUI", status.mods & 8);
+        oled_write_ln(status.caps ? "CAPS" : "", false);
+    } else {
+        // Five characters per line
+        oled_write("LAYER", false);
+        oled_write(layer_names[status.layer], false);
+        oled_write_ln("", false);
+        oled_write("WPM  ", false);
+        oled_write_ln(wpm, false);
+        oled_write_ln("", false);
+        oled_write_ln("CTL", status.mods & 1);
+        oled_write_ln("SFT", status.mods & 2);
+        oled_write_ln("ALT", status.mods & 4);
+        oled_write_ln("GUI", status.mods & 8);
+        oled_write_ln("", false);
+        oled_write_ln(status.caps ? "CAPS" : "", false);
+    }
+    return false;
+}
+
+class Oled : public TestFixture {
+   protected:
+    void SetUp() override {
+        // Display memory is undefined until written
+        display = {};
+        memset(display.memory, 0xA5, sizeof(display.memory));
+        display.end_column = 127;
+        display.end_page   = 7;
+        i2c_test_attach(display_receive);
+        status = {};
+    }
+
+    void TearDown() override {
+        i2c_test_attach(NULL);
+    }
+
+    void init(oled_rotation_t rotation) {
+        status.portrait = rotation == OLED_ROTATION_90;
+        ASSERT_TRUE(oled_init(rotation));
+        draw_frame();
+    }
+
+    /* Runs oled_task() until the frame is on the display, returning the bytes sent over I2C. */
+    uint32_t draw_frame(void) {
+        const uint8_t *      buffer = oled_read_raw(0).current_element;
+        std::vector<uint8_t> before(buffer, buffer + OLED_MATRIX_SIZE);
+
+        i2c_test_reset_counters();
+        do {
+            oled_task();
+            tasks++;
+        } while (oled_dirty);
+        EXPECT_TRUE(display_matches_buffer());
+
+        // Whole blocks, each with its window command
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+            if (memcmp(&before[i], &buffer[i], OLED_BLOCK_SIZE)) {
+                block_bytes += 1 + 7 + 2 + OLED_BLOCK_SIZE;
+            }
+        }
+        return i2c_test_bytes_written();
+    }
+
+    bool display_matches_buffer(void) {
+        const uint8_t *buffer = oled_read_raw(0).current_element;
+        const uint8_t  width  = status.portrait ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+        const uint8_t  height = status.portrait ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT;
+        for (uint8_t x = 0; x < width; x++) {
+            for (uint8_t y = 0; y < height; y++) {
+                // Rotated by 90 degrees, the buffer starts at the bottom left of the display
+                uint8_t column = status.portrait ? y : x;
+                uint8_t row    = status.portrait ? OLED_DISPLAY_HEIGHT - 1 - x : y;
+                bool    pixel  = buffer[y / 8 * width + x] >> (y % 8) & 1;
+                if ((display.memory[row / 8][column] >> (row % 8) & 1) != pixel) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /* Typing away for a while, with the occasional layer, modifier and caps lock change. */
+    void run_workload(void) {
+        const int frames     = 60;
+        uint32_t  total_sent = 0;
+        uint32_t  max_sent   = 0;
+        tasks                = 0;
+        block_bytes          = 0;
+
+        for (int frame = 0; frame < frames; frame++) {
+            status.wpm = 40 + (frame * 7) % 30;
+            if (frame % 10 == 9) {
+                status.layer = (status.layer + 1) % 4;
+            }
+            if (frame % 7 == 3) {
+                status.mods ^= 1 << (frame % 4);
+            }
+            if (frame % 25 == 24) {
+                status.caps = !status.caps;
+            }
+
+            uint32_t sent = draw_frame();
+            total_sent += sent;
+            max_sent = std::max(max_sent, sent);
+        }
+
+        RecordProperty("bytes_per_frame", total_sent / frames);
+        RecordProperty("max_bytes_per_frame", max_sent);
+        RecordProperty("bytes_per_oled_task", total_sent / tasks);
+        RecordProperty("block_bytes_per_frame", block_bytes / frames);
+        EXPECT_LT(total_sent, block_bytes);
+    }
+
+    uint32_t tasks       = 0;
+    uint32_t block_bytes = 0;
+};
+
+TEST_F(Oled, UnchangedScreenNotSent) {
+    init(OLED_ROTATION_0);
+    EXPECT_EQ(draw_frame(), 0);
+
+    // Clearing and redrawing the same screen marks every block as dirty
+    oled_clear();
+    EXPECT_EQ(draw_frame(), 0);
+}
+
+TEST_F(Oled, OnlyChangedColumnsSent) {
+    status.wpm = 42;
+    init(OLED_ROTATION_0);
+
+    // A single character, with its window command
+    status.wpm = 43;
+    uint32_t sent = draw_frame();
+    EXPECT_GT(sent, 0);
+    EXPECT_LE(sent, 1 + 7 + 2 + OLED_FONT_WIDTH);
+}
+
+TEST_F(Oled, RotatedCharacterSent) {
+    status.wpm = 42;
+    init(OLED_ROTATION_90);
+
+    // The character straddles two 8x8 tiles, rotated into a window one above the other
+    status.wpm = 43;
+    uint32_t sent = draw_frame();
+    EXPECT_GT(sent, 0);
+    EXPECT_LE(sent, 1 + 7 + 2 + 16);
+}
+
+TEST_F(Oled, StatusScreen) {
+    init(OLED_ROTATION_0);
+    run_workload();
+}
+
+TEST_F(Oled, RotatedStatusScreen) {
+    init(OLED_ROTATION_90);
+    run_workload();
+}
+
+TEST_F(Oled, InitResendsDisplay) {
+    init(OLED_ROTATION_0);
+
+    // Power cycled, with the buffer redrawn as it was
+    memset(display.memory, 0xA5, sizeof(display.memory));
+    display.start_column = display.column = 0;
+    display.end_column                    = 127;
+    display.start_page = display.page = 0;
+    display.end_page                  = 7;
+    init(OLED_ROTATION_0);
+    EXPECT_TRUE(display_matches_buffer());
+}
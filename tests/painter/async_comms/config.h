@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// TRUE is only defined by ChibiOS
+#define QUANTUM_PAINTER_ASYNC_COMMS 1
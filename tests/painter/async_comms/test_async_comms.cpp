@@ -0,0 +1,250 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_surface_internal.h"
+#include "djinn.qgf.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 320
+
+// A 40 MHz SPI bus, and the cost of decoding an image pixel into the pixdata buffer
+#define TRANSFER_NS_PER_BYTE 200
+#define DECODE_NS_PER_PIXEL 300
+
+/*
+ * Stand-in for an RGB565 panel behind an SPI bus with DMA. Time is simulated
+ * on a virtual clock: transfers take TRANSFER_NS_PER_BYTE per byte, decoding
+ * pixels takes DECODE_NS_PER_PIXEL, and every poll of an unfinished transfer
+ * takes a microsecond.
+ *
+ * Background transfers only land in the panel memory once they complete, so
+ * pixels overwritten while still being transmitted show up as corruption.
+ */
+static struct {
+    uint64_t              now_ns;
+    uint64_t              waiting_ns;
+    std::vector<uint16_t> memory;
+    uint16_t              l, t, r, b, x, y;
+    const uint8_t *       in_flight;
+    uint32_t              in_flight_bytes;
+    uint64_t              complete_at_ns;
+} panel;
+
+static void panel_receive(const void *data, uint32_t byte_count) {
+    const uint16_t *pixels = (const uint16_t *)data;
+    for (uint32_t i = 0; i < byte_count / sizeof(uint16_t); i++) {
+        panel.memory[panel.y * PANEL_WIDTH + panel.x] = pixels[i];
+        if (++panel.x > panel.r) {
+            panel.x = panel.l;
+            if (++panel.y > panel.b) {
+                panel.y = panel.t;
+            }
+        }
+    }
+}
+
+static bool panel_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool panel_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void panel_comms_stop(painter_device_t device) {}
+
+static uint32_t panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    panel.now_ns += byte_count * TRANSFER_NS_PER_BYTE;
+    panel_receive(data, byte_count);
+    return byte_count;
+}
+
+static uint32_t panel_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    EXPECT_EQ(panel.in_flight, nullptr);
+    panel.in_flight       = (const uint8_t *)data;
+    panel.in_flight_bytes = byte_count;
+    panel.complete_at_ns  = panel.now_ns + byte_count * TRANSFER_NS_PER_BYTE;
+    return byte_count;
+}
+
+static bool panel_comms_is_complete(painter_device_t device) {
+    if (panel.in_flight == nullptr) {
+        return true;
+    }
+    if (panel.now_ns < panel.complete_at_ns) {
+        panel.now_ns += 1000;
+        panel.waiting_ns += 1000;
+        return false;
+    }
+    panel_receive(panel.in_flight, panel.in_flight_bytes);
+    panel.in_flight = nullptr;
+    return true;
+}
+
+static const painter_comms_vtable_t sync_comms_vtable = {
+    .comms_init  = panel_comms_init,
+    .comms_start = panel_comms_start,
+    .comms_stop  = panel_comms_stop,
+    .comms_send  = panel_comms_send,
+};
+
+static const painter_comms_vtable_t async_comms_vtable = {
+    .comms_init        = panel_comms_init,
+    .comms_start       = panel_comms_start,
+    .comms_stop        = panel_comms_stop,
+    .comms_send        = panel_comms_send,
+    .comms_send_async  = panel_comms_send_async,
+    .comms_is_complete = panel_comms_is_complete,
+};
+
+static bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool panel_clear(painter_device_t device) {
+    return true;
+}
+
+static bool panel_flush(painter_device_t device) {
+    return true;
+}
+
+static bool panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    // Window commands go out synchronously, after any pixel data still in flight
+    qp_comms_wait(device);
+    panel.now_ns += 11 * TRANSFER_NS_PER_BYTE;
+    panel.l = panel.x = left;
+    panel.t = panel.y = top;
+    panel.r           = right;
+    panel.b           = bottom;
+    return true;
+}
+
+static bool panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send_async(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+static bool panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    panel.now_ns += pixel_count * DECODE_NS_PER_PIXEL;
+    return rgb565_surface_driver_vtable.base.append_pixels(device, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+}
+
+static const painter_driver_vtable_t panel_driver_vtable = {
+    .init            = panel_init,
+    .power           = panel_power,
+    .clear           = panel_clear,
+    .flush           = panel_flush,
+    .viewport        = panel_viewport,
+    .pixdata         = panel_pixdata,
+    .palette_convert = rgb565_surface_driver_vtable.base.palette_convert,
+    .append_pixels   = panel_append_pixels,
+    .append_pixdata  = rgb565_surface_driver_vtable.base.append_pixdata,
+};
+
+class AsyncComms : public TestFixture {
+   protected:
+    void SetUp() override {
+        panel          = {};
+        panel.memory   = std::vector<uint16_t>(PANEL_WIDTH * PANEL_HEIGHT);
+        reference_data = std::vector<uint8_t>(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16));
+        reference      = qp_make_rgb565_surface_advanced(&reference_device, 1, PANEL_WIDTH, PANEL_HEIGHT, reference_data.data());
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0));
+    }
+
+    painter_device_t make_panel(const painter_comms_vtable_t *comms_vtable) {
+        panel_device                       = {};
+        panel_device.driver_vtable         = &panel_driver_vtable;
+        panel_device.comms_vtable          = comms_vtable;
+        panel_device.panel_width           = PANEL_WIDTH;
+        panel_device.panel_height          = PANEL_HEIGHT;
+        panel_device.native_bits_per_pixel = 16;
+        EXPECT_TRUE(qp_init(&panel_device, QP_ROTATION_0));
+        return &panel_device;
+    }
+
+    /* Returns how long the call held up the main loop for, in microseconds. */
+    template <typename Draw>
+    uint32_t stall_us(Draw draw) {
+        uint64_t start   = panel.now_ns;
+        panel.waiting_ns = 0;
+        EXPECT_TRUE(draw());
+        EXPECT_EQ(panel.in_flight, nullptr);
+        return (panel.now_ns - start) / 1000;
+    }
+
+    bool panel_matches_reference(void) {
+        return memcmp(panel.memory.data(), reference_data.data(), reference_data.size()) == 0;
+    }
+
+    surface_painter_device_t reference_device = {};
+    std::vector<uint8_t>     reference_data;
+    painter_device_t         reference;
+    painter_driver_t         panel_device;
+};
+
+TEST_F(AsyncComms, ImageDecodeOverlapsTransfer) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_djinn);
+    ASSERT_NE(image, nullptr);
+    ASSERT_TRUE(qp_drawimage(reference, 0, 0, image));
+
+    painter_device_t sync_panel = make_panel(&sync_comms_vtable);
+    uint32_t         sync_us    = stall_us([&] { return qp_drawimage(sync_panel, 0, 0, image); });
+    EXPECT_TRUE(panel_matches_reference());
+
+    panel.memory.assign(panel.memory.size(), 0);
+    painter_device_t async_panel = make_panel(&async_comms_vtable);
+    uint32_t         async_us    = stall_us([&] { return qp_drawimage(async_panel, 0, 0, image); });
+    EXPECT_TRUE(panel_matches_reference());
+
+    // The image is decoded into one pixdata buffer while the other is transmitted
+    RecordProperty("sync_stall_us", sync_us);
+    RecordProperty("async_stall_us", async_us);
+    RecordProperty("async_waiting_us", panel.waiting_ns / 1000);
+    EXPECT_LT(async_us * 10, sync_us * 8);
+
+    qp_close_image(image);
+}
+
+TEST_F(AsyncComms, SurfaceDrawStreamsInBackground) {
+    // Gradient, so every pixdata block differs from the previous one
+    for (uint16_t y = 0; y < PANEL_HEIGHT; y += 8) {
+        qp_rect(reference, 0, y, PANEL_WIDTH - 1, y + 7, y, 255, 255, true);
+    }
+
+    painter_device_t async_panel = make_panel(&async_comms_vtable);
+    uint32_t         async_us    = stall_us([&] { return qp_surface_draw(reference, async_panel, 0, 0, true); });
+    EXPECT_TRUE(panel_matches_reference());
+
+    // Nothing to decode, so the stall is down to the transfer time
+    RecordProperty("async_stall_us", async_us);
+    EXPECT_GE(async_us, PANEL_WIDTH * PANEL_HEIGHT * 2 * TRANSFER_NS_PER_BYTE / 1000);
+}
+
+TEST_F(AsyncComms, CommandsWaitForPixelData) {
+    painter_device_t async_panel = make_panel(&async_comms_vtable);
+
+    // Each rectangle's window command has to wait for the previous rectangle's pixels
+    EXPECT_TRUE(qp_rect(reference, 10, 10, 50, 50, HSV_RED, true));
+    EXPECT_TRUE(qp_rect(reference, 30, 30, 70, 70, HSV_GREEN, true));
+    EXPECT_TRUE(qp_rect(async_panel, 10, 10, 50, 50, HSV_RED, true));
+    EXPECT_EQ(panel.in_flight, nullptr);
+    EXPECT_TRUE(qp_rect(async_panel, 30, 30, 70, 70, HSV_GREEN, true));
+    EXPECT_EQ(panel.in_flight, nullptr);
+    EXPECT_TRUE(panel_matches_reference());
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Normally supplied by keyboards using Quantum Painter's I2C comms
+#define I2C_TIMEOUT 100
@@ -0,0 +1,8 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = sh1106_i2c ld7032_i2c
+
+# The panels are driven through the test platform's I2C stand-in
+SRC += i2c_master.c
@@ -0,0 +1,187 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "color.h"
+#include "i2c_master.h"
+#include "qp.h"
+#include "qp_sh1106.h"
+#include "qp_ld7032.h"
+#include "qp_surface_internal.h"
+}
+
+#define SH1106_ADDRESS 0x3C
+#define LD7032_ADDRESS 0x30
+
+/*
+ * Stand-ins for the panels on the test platform's I2C bus, decoding just
+ * enough of each controller's commands to follow where data is written.
+ *
+ * The SH1106 uses page addressing: one command per transaction, then data
+ * written to consecutive columns of the page. The LD7032 writes rows of
+ * 8 pixel wide bytes within a box set by its X/Y box address commands.
+ */
+static struct {
+    uint8_t memory[8][128];
+    uint8_t page, column;
+} sh1106;
+
+static struct {
+    uint8_t memory[40][16];
+    uint8_t x_start, x_end, y_start, y_end;
+} ld7032;
+
+static uint32_t ld7032_rows_written;
+
+static i2c_status_t sh1106_receive(const uint8_t *data, uint16_t length) {
+    if (data[0] == 0x40) {
+        for (uint16_t i = 1; i < length; i++) {
+            sh1106.memory[sh1106.page][sh1106.column++] = data[i];
+        }
+    } else if (length == 2 && (data[1] & 0xF8) == 0xB0) {
+        sh1106.page = data[1] & 0x07;
+    } else if (length == 2 && (data[1] & 0xF0) == 0x00) {
+        sh1106.column = (sh1106.column & 0xF0) | (data[1] & 0x0F);
+    } else if (length == 2 && (data[1] & 0xF0) == 0x10) {
+        sh1106.column = (sh1106.column & 0x0F) | (data[1] & 0x0F) << 4;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+static i2c_status_t ld7032_receive(const uint8_t *data, uint16_t length) {
+    switch (data[0]) {
+        case 0x34: // LD7032_X_BOX_ADR_START
+            ld7032.x_start = data[1];
+            break;
+        case 0x35: // LD7032_X_BOX_ADR_END
+            ld7032.x_end = data[1];
+            break;
+        case 0x36: // LD7032_Y_BOX_ADR_START
+            ld7032.y_start = data[1];
+            break;
+        case 0x37: // LD7032_Y_BOX_ADR_END
+            ld7032.y_end = data[1];
+            break;
+        case 0x08: // LD7032_DATA_RW
+            EXPECT_EQ(ld7032.y_start, ld7032.y_end);
+            EXPECT_EQ(length - 1, ld7032.x_end - ld7032.x_start + 1);
+            memcpy(&ld7032.memory[ld7032.y_start][ld7032.x_start], &data[1], length - 1);
+            ld7032_rows_written++;
+            break;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+static i2c_status_t panels_receive(uint8_t address, const uint8_t *data, uint16_t length) {
+    if (address == SH1106_ADDRESS << 1) {
+        return sh1106_receive(data, length);
+    }
+    EXPECT_EQ(address, LD7032_ADDRESS << 1);
+    return ld7032_receive(data, length);
+}
+
+/* Panels are never released, so each is made once and reinitialised by the tests using it. */
+static painter_device_t sh1106_panel(void) {
+    static painter_device_t device = qp_sh1106_make_i2c_device(128, 64, SH1106_ADDRESS);
+    return device;
+}
+
+static bool reference_pixel(const std::vector<uint8_t> &buffer, uint16_t width, uint16_t x, uint16_t y) {
+    uint32_t pixel_num = y * width + x;
+    return buffer[pixel_num / 8] >> (pixel_num % 8) & 1;
+}
+
+class OledPanel : public TestFixture {
+   protected:
+    void SetUp() override {
+        sh1106 = {};
+        ld7032 = {};
+        i2c_test_attach(panels_receive);
+    }
+
+    void TearDown() override {
+        i2c_test_attach(NULL);
+    }
+
+    /* Initialises the panel along with a surface of the same geometry, which gets the same drawing. */
+    void init(painter_device_t device, painter_rotation_t rotation, uint16_t width, uint16_t height) {
+        panel = device;
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, rotation));
+
+        reference_device = {};
+        reference_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, 1), 0);
+        reference = qp_make_mono1bpp_surface_advanced(&reference_device, 1, width, height, reference_data.data());
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0));
+
+        // The whole panel is sent initially
+        ASSERT_TRUE(qp_flush(panel));
+    }
+
+    void rect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+        EXPECT_TRUE(qp_rect(panel, left, top, right, bottom, HSV_WHITE, true));
+        EXPECT_TRUE(qp_rect(reference, left, top, right, bottom, HSV_WHITE, true));
+    }
+
+    /* Flushes the panel, returning the bytes sent over I2C. */
+    uint32_t flush(void) {
+        i2c_test_reset_counters();
+        ld7032_rows_written = 0;
+        EXPECT_TRUE(qp_flush(panel));
+        return i2c_test_bytes_written();
+    }
+
+    painter_device_t         panel;
+    surface_painter_device_t reference_device;
+    std::vector<uint8_t>     reference_data;
+    painter_device_t         reference;
+};
+
+TEST_F(OledPanel, Sh1106OppositeCornersSentSeparately) {
+    init(sh1106_panel(), QP_ROTATION_0, 128, 64);
+
+    rect(0, 0, 15, 7);
+    rect(112, 56, 127, 63);
+
+    // One page of 16 columns each, after the page and column commands
+    EXPECT_EQ(flush(), 2 * (3 * 3 + 2 + 16));
+
+    for (uint16_t y = 0; y < 64; y++) {
+        for (uint16_t x = 0; x < 128; x++) {
+            EXPECT_EQ(sh1106.memory[y / 8][x] >> (y % 8) & 1, reference_pixel(reference_data, 128, x, y)) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST_F(OledPanel, Sh1106Rotated) {
+    init(sh1106_panel(), QP_ROTATION_90, 64, 128);
+
+    rect(0, 0, 7, 15);
+    rect(40, 100, 63, 127);
+    flush();
+
+    // Surface columns run down the panel pages, and surface rows right to left across the panel columns
+    for (uint16_t y = 0; y < 128; y++) {
+        for (uint16_t x = 0; x < 64; x++) {
+            EXPECT_EQ(sh1106.memory[x / 8][127 - y] >> (x % 8) & 1, reference_pixel(reference_data, 64, x, y)) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST_F(OledPanel, Ld7032SendsDirtyBounds) {
+    init(qp_ld7032_make_i2c_device(128, 40, LD7032_ADDRESS), QP_ROTATION_0, 128, 40);
+
+    rect(0, 0, 15, 3);
+    rect(112, 30, 127, 39);
+    flush();
+
+    // Every row between the two regions, as the driver sends the bounding box
+    EXPECT_EQ(ld7032_rows_written, 40);
+    for (uint16_t y = 0; y < 40; y++) {
+        EXPECT_EQ(memcmp(ld7032.memory[y], &reference_data[y * 16], 16), 0) << "y=" << y;
+    }
+}
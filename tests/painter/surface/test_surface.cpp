@@ -0,0 +1,162 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 135
+
+/*
+ * The panel is a second RGB565 surface on the dummy comms backend, with its
+ * viewport and pixdata calls counted, so each frame's transfer can be
+ * measured and the panel contents compared against the framebuffer.
+ */
+static surface_painter_driver_vtable_t panel_vtable;
+static uint32_t                        pixels_sent;
+static uint32_t                        viewports_set;
+
+static bool panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    viewports_set++;
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    pixels_sent += native_pixel_count;
+    return rgb565_surface_driver_vtable.base.pixdata(device, pixel_data, native_pixel_count);
+}
+
+class Surface : public TestFixture {
+   protected:
+    void SetUp() override {
+        framebuffer_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16), 0);
+        panel_data.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16), 0);
+
+        framebuffer = qp_make_rgb565_surface_advanced(&devices[0], 1, PANEL_WIDTH, PANEL_HEIGHT, framebuffer_data.data());
+        panel       = qp_make_rgb565_surface_advanced(&devices[1], 1, PANEL_WIDTH, PANEL_HEIGHT, panel_data.data());
+
+        panel_vtable                  = rgb565_surface_driver_vtable;
+        panel_vtable.base.viewport    = panel_viewport;
+        panel_vtable.base.pixdata     = panel_pixdata;
+        devices[1].base.driver_vtable = (painter_driver_vtable_t *)&panel_vtable;
+
+        ASSERT_TRUE(qp_init(framebuffer, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+
+        // Background, sent in full
+        qp_rect(framebuffer, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, HSV_BLUE, true);
+        EXPECT_EQ(draw_frame(), PANEL_WIDTH * PANEL_HEIGHT);
+    }
+
+    /* Copies the framebuffer to the panel, returning the number of pixels transferred. */
+    uint32_t draw_frame(void) {
+        pixels_sent   = 0;
+        viewports_set = 0;
+        EXPECT_TRUE(qp_surface_draw(framebuffer, panel, 0, 0, false));
+        EXPECT_EQ(framebuffer_data, panel_data);
+        return pixels_sent;
+    }
+
+    surface_painter_device_t devices[2] = {};
+    std::vector<uint8_t>     framebuffer_data;
+    std::vector<uint8_t>     panel_data;
+    painter_device_t         framebuffer;
+    painter_device_t         panel;
+};
+
+TEST_F(Surface, UnchangedFrameNotSent) {
+    qp_rect(framebuffer, 10, 10, 50, 20, HSV_BLUE, true);
+    EXPECT_EQ(draw_frame(), 0);
+    EXPECT_EQ(viewports_set, 0);
+}
+
+TEST_F(Surface, OppositeCornersSentSeparately) {
+    // A clock in the top left, and a layer indicator in the bottom right
+    qp_rect(framebuffer, 0, 0, 39, 15, HSV_WHITE, true);
+    qp_rect(framebuffer, PANEL_WIDTH - 20, PANEL_HEIGHT - 10, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, HSV_RED, true);
+
+    EXPECT_EQ(draw_frame(), 40 * 16 + 20 * 10);
+    EXPECT_EQ(viewports_set, 2);
+}
+
+TEST_F(Surface, NearbyUpdatesCoalesced) {
+    // Characters of a single line of text, separated by a few unchanged columns
+    for (uint16_t x = 0; x < 60; x += 8) {
+        qp_rect(framebuffer, x, 0, x + 5, 7, HSV_WHITE, true);
+    }
+
+    EXPECT_EQ(draw_frame(), 62 * 8);
+    EXPECT_EQ(viewports_set, 1);
+}
+
+TEST_F(Surface, RegionsLimitedAndNeverOverlap) {
+    // More scattered updates than there are regions, a growing region swallows the ones it overlaps
+    for (uint16_t i = 0; i < 12; i++) {
+        qp_setpixel(framebuffer, (i * 37) % PANEL_WIDTH, (i * 53) % PANEL_HEIGHT, HSV_WHITE);
+    }
+    qp_rect(framebuffer, 0, 0, PANEL_WIDTH - 1, 60, HSV_GREEN, true);
+
+    uint32_t sent = draw_frame();
+    EXPECT_LE(viewports_set, SURFACE_DIRTY_RECTS);
+    EXPECT_LE(sent, PANEL_WIDTH * PANEL_HEIGHT);
+}
+
+TEST_F(Surface, DashboardWorkload) {
+    const int frames         = 60;
+    uint32_t  total_sent     = 0;
+    uint32_t  total_bounding = 0;
+    uint32_t  max_sent       = 0;
+    uint8_t   layer          = 0;
+    uint16_t  wpm            = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+        uint16_t l = UINT16_MAX, t = UINT16_MAX, r = 0, b = 0;
+        auto     changed = [&](uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+            l = QP_MIN(l, left);
+            t = QP_MIN(t, top);
+            r = QP_MAX(r, right);
+            b = QP_MAX(b, bottom);
+        };
+
+        // Clock seconds digit, top left, every frame
+        qp_rect(framebuffer, 32, 0, 39, 15, (frame % 2) ? HSV_WHITE : HSV_YELLOW, true);
+        changed(32, 0, 39, 15);
+
+        // Layer indicator, bottom right, every few frames
+        if (frame % 15 == 14) {
+            layer = (layer + 1) % 4;
+            qp_rect(framebuffer, PANEL_WIDTH - 20, PANEL_HEIGHT - 10, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, layer * 60, 255, 255, true);
+            changed(PANEL_WIDTH - 20, PANEL_HEIGHT - 10, PANEL_WIDTH - 1, PANEL_HEIGHT - 1);
+        }
+
+        // WPM bar along the bottom left, changing length
+        uint16_t new_wpm = (frame * 7) % 100;
+        if (new_wpm != wpm) {
+            uint16_t from = QP_MIN(wpm, new_wpm), to = QP_MAX(wpm, new_wpm);
+            qp_rect(framebuffer, from, PANEL_HEIGHT - 6, to, PANEL_HEIGHT - 1, new_wpm > wpm ? HSV_GREEN : HSV_BLUE, true);
+            changed(from, PANEL_HEIGHT - 6, to, PANEL_HEIGHT - 1);
+            wpm = new_wpm;
+        }
+
+        uint32_t sent = draw_frame();
+        EXPECT_LE(viewports_set, SURFACE_DIRTY_RECTS);
+        total_sent += sent;
+        total_bounding += (uint32_t)(r - l + 1) * (b - t + 1);
+        max_sent = QP_MAX(max_sent, sent);
+    }
+
+    // A single bounding box would span most of the panel every frame
+    RecordProperty("pixels_per_frame", total_sent / frames);
+    RecordProperty("max_pixels_per_frame", max_sent);
+    RecordProperty("bounding_box_pixels_per_frame", total_bounding / frames);
+    EXPECT_LT(total_sent * 10, total_bounding);
+}
@@ -0,0 +1,184 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+static constexpr uint32_t report_interval = POINTING_DEVICE_REPORT_INTERVAL_MS;
+
+/* A button held by the user hook rather than the sensor, as a drag lock would. */
+static bool user_button_held = false;
+
+extern "C" report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) {
+    if (user_button_held) {
+        mouse_report.buttons |= MOUSE_BTN2;
+    } else {
+        mouse_report.buttons &= ~MOUSE_BTN2;
+    }
+    return mouse_report;
+}
+
+struct SentReport {
+    uint32_t time;
+    int16_t  x;
+    int16_t  y;
+    uint8_t  buttons;
+};
+
+class PointingAccumulate : public TestFixture {
+   protected:
+    void SetUp() override {
+        user_button_held = false;
+    }
+
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) { sent.push_back({timer_read32(), report.x, report.y, report.buttons}); }));
+    }
+
+    /* Stops the sensor and waits until all of the accumulated motion has been reported. */
+    void drain(void) {
+        pd_clear_movement();
+        idle_for(1000);
+    }
+
+    int32_t sent_x(void) {
+        int32_t x = 0;
+        for (auto &report : sent) {
+            x += report.x;
+        }
+        return x;
+    }
+
+    int32_t sent_y(void) {
+        int32_t y = 0;
+        for (auto &report : sent) {
+            y += report.y;
+        }
+        return y;
+    }
+
+    std::vector<SentReport> sent;
+};
+
+TEST_F(PointingAccumulate, HighCpiTraceIsCoalescedWithoutLosingMotion) {
+    TestDriver driver;
+    record_reports(driver);
+
+    /* A fast, uneven swipe read every scan, as a high CPI sensor would produce. */
+    int32_t  expected_x = 0, expected_y = 0;
+    uint32_t reads      = 500;
+    for (uint32_t scan = 0; scan < reads; scan++) {
+        int16_t x = (int16_t)((scan * 37) % 120) - 20;
+        int16_t y = (int16_t)((scan * 53) % 90) - 60;
+        pd_set_x(x);
+        pd_set_y(y);
+        expected_x += x;
+        expected_y += y;
+        run_one_scan_loop();
+    }
+    drain();
+
+    EXPECT_EQ(sent_x(), expected_x);
+    EXPECT_EQ(sent_y(), expected_y);
+
+    /* Never more than one report per interval. */
+    for (size_t i = 1; i < sent.size(); i++) {
+        EXPECT_GE(sent[i].time - sent[i - 1].time, report_interval);
+    }
+    RecordProperty("sensor_reads", reads);
+    RecordProperty("reports_sent", sent.size());
+    EXPECT_LT(sent.size(), reads / 2);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, LargeMotionIsSplitAcrossReports) {
+    TestDriver driver;
+    record_reports(driver);
+
+    /* The first read is reported straight away, the next interval accumulates 4 * 100 counts. */
+    pd_set_x(100);
+    pd_set_y(-100);
+    idle_for(report_interval + 1);
+    drain();
+
+    ASSERT_EQ(sent.size(), 5);
+    std::vector<int16_t> xs;
+    for (auto &report : sent) {
+        xs.push_back(report.x);
+    }
+    EXPECT_EQ(xs, (std::vector<int16_t>{100, 127, 127, 127, 19}));
+    EXPECT_EQ(sent[1].y, XY_REPORT_MIN);
+    EXPECT_EQ(sent_x(), 500);
+    EXPECT_EQ(sent_y(), -500);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, ButtonChangeIsSentImmediately) {
+    TestDriver driver;
+    record_reports(driver);
+
+    pd_set_x(10);
+    run_one_scan_loop();
+    pd_set_x(5);
+    run_one_scan_loop();
+
+    /* The button press doesn't wait for the report interval, and carries the motion accumulated so far. */
+    pd_press_button(0);
+    run_one_scan_loop();
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(sent[1].buttons, 1);
+    EXPECT_EQ(sent[1].x, 10);
+    EXPECT_EQ(sent[1].time - sent[0].time, 2);
+
+    pd_release_button(0);
+    pd_clear_movement();
+    run_one_scan_loop();
+    ASSERT_EQ(sent.size(), 3);
+    EXPECT_EQ(sent[2].buttons, 0);
+    drain();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, ButtonChangeFromHookIsSentImmediately) {
+    TestDriver driver;
+    record_reports(driver);
+
+    /* Well clear of any earlier report, so the first read is sent straight away. */
+    idle_for(report_interval);
+    pd_set_x(10);
+    run_one_scan_loop();
+    run_one_scan_loop();
+
+    /* The button the hook adds counts as a change, like one from the sensor. */
+    user_button_held = true;
+    run_one_scan_loop();
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(sent[1].buttons, MOUSE_BTN2);
+    EXPECT_EQ(sent[1].time - sent[0].time, 2);
+
+    /* While it stays held, the motion is back to one report per interval. */
+    idle_for(report_interval * 4);
+    EXPECT_LE(sent.size(), 2 + 4);
+    for (size_t i = 2; i < sent.size(); i++) {
+        EXPECT_EQ(sent[i].buttons, MOUSE_BTN2);
+        EXPECT_GE(sent[i].time - sent[i - 1].time, report_interval);
+    }
+
+    user_button_held = false;
+    pd_clear_movement();
+    run_one_scan_loop();
+    EXPECT_EQ(sent.back().buttons, 0);
+    drain();
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,29 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+/*
+ * Four keys along the top row of the matrix. The first two LEDs have their
+ * PWM registers in the first three 16 byte blocks, the other two in the next
+ * three blocks.
+ */
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, SW1_CS1, SW2_CS1, SW3_CS1},
+    {0, SW1_CS2, SW2_CS2, SW3_CS2},
+    {0, SW4_CS1, SW5_CS1, SW6_CS1},
+    {0, SW4_CS2, SW5_CS2, SW6_CS2},
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {0, 1, 2, 3, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    },
+    {{0, 0}, {16, 0}, {32, 0}, {48, 0}},
+    {LED_FLAG_KEYLIGHT, LED_FLAG_KEYLIGHT, LED_FLAG_KEYLIGHT, LED_FLAG_KEYLIGHT},
+};
+// clang-format on
@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = is31fl3733
+
+# The driver is connected through the test platform's I2C stand-in
+SRC += \
+	i2c_master.c \
+	leds.c
@@ -0,0 +1,55 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+using testing::_;
+
+/*
+ * Counts the PWM bytes the IS31FL3733 driver sends for each frame, with the
+ * LEDs set to white so that a change of brightness touches every channel.
+ */
+class FlushBytes : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_keymap({KeymapKey(0, 0, 0, KC_NO)});
+        rgb_matrix_sethsv_noeeprom(0, 0, 100);
+    }
+
+    void scan(uint16_t count) {
+        for (uint16_t i = 0; i < count; i++) {
+            run_one_scan_loop();
+        }
+    }
+
+    TestDriver driver;
+};
+
+TEST_F(FlushBytes, UnchangedFramesSendNothing) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    scan(100);
+
+    rgb_matrix_reset_flush_bytes();
+    scan(100);
+    EXPECT_EQ(rgb_matrix_flush_bytes_per_frame(RGB_MATRIX_SOLID_COLOR), 0);
+}
+
+TEST_F(FlushBytes, KeypressSendsOnlyTheBlocksOfItsLed) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    scan(100);
+
+    EXPECT_NO_REPORT(driver);
+    press_key(0, 0);
+    scan(10);
+    release_key(0, 0);
+
+    // While the key fades, every frame changes the three 16 byte blocks holding its LED's channels
+    rgb_matrix_reset_flush_bytes();
+    scan(200);
+    EXPECT_EQ(rgb_matrix_flush_bytes_per_frame(RGB_MATRIX_SOLID_REACTIVE_SIMPLE), 3 * 16);
+}
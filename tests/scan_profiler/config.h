@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Count milliseconds of the simulated timer, so the tests control every duration
+#define SCAN_PROFILER_TIMESTAMP() timer_read32()
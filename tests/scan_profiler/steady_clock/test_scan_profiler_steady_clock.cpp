@@ -0,0 +1,66 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "scan_profiler.h"
+}
+
+using testing::_;
+
+/* Without SCAN_PROFILER_TIMESTAMP() in config.h, the profiler times tasks in nanoseconds of the host's steady clock. */
+static constexpr uint32_t key_processing_ns = 200000;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    // Busy for a while, however fast the simulated timer moves
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::nanoseconds(key_processing_ns)) {
+    }
+    return true;
+}
+
+class ScanProfilerSteadyClock : public TestFixture {
+   protected:
+    void SetUp() override {
+        scan_profiler_reset();
+    }
+
+    scan_profiler_stats_t stats(scan_profiler_task_t task) {
+        scan_profiler_stats_t stats;
+        EXPECT_TRUE(scan_profiler_get_stats(task, &stats));
+        return stats;
+    }
+};
+
+TEST_F(ScanProfilerSteadyClock, DurationsOfRealWork) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    idle_for(8);
+
+    // Both key events took at least the time spent in process_record_user()
+    auto matrix = stats(SCAN_PROFILER_MATRIX_TASK);
+    EXPECT_EQ(matrix.count, 10);
+    EXPECT_GE(matrix.max, key_processing_ns);
+    EXPECT_GE(matrix.avg, 2 * key_processing_ns / 10);
+
+    // Every scan does some work, and the clock is fine grained enough to see it
+    auto keyboard = stats(SCAN_PROFILER_KEYBOARD_TASK);
+    EXPECT_EQ(keyboard.count, 10);
+    EXPECT_GT(keyboard.min, 0);
+    EXPECT_GE(keyboard.max, matrix.max);
+
+    VERIFY_AND_CLEAR(driver);
+}
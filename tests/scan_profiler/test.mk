@@ -0,0 +1,2 @@
+SCAN_PROFILER_ENABLE = yes
+CAPS_WORD_ENABLE = yes
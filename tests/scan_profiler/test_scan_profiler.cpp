@@ -0,0 +1,145 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "scan_profiler.h"
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+/* config.h has the profiler count milliseconds of the simulated timer. */
+static uint32_t key_processing_time = 0;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    advance_time(key_processing_time);
+    return true;
+}
+
+class ScanProfiler : public TestFixture {
+   protected:
+    void SetUp() override {
+        key_processing_time = 0;
+        scan_profiler_reset();
+    }
+
+    scan_profiler_stats_t stats(scan_profiler_task_t task) {
+        scan_profiler_stats_t stats;
+        EXPECT_TRUE(scan_profiler_get_stats(task, &stats));
+        return stats;
+    }
+
+    /* Records one sample of the given duration for a task. */
+    void record(scan_profiler_task_t task, uint32_t duration) {
+        scan_profiler_enter(task);
+        advance_time(duration);
+        scan_profiler_exit(task);
+    }
+};
+
+TEST_F(ScanProfiler, KeyProcessingIsAttributedToMatrixTask) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    key_processing_time = 5;
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    idle_for(8);
+
+    auto matrix = stats(SCAN_PROFILER_MATRIX_TASK);
+    EXPECT_EQ(matrix.count, 10);
+    EXPECT_EQ(matrix.min, 0);
+    EXPECT_EQ(matrix.max, 5);
+    EXPECT_EQ(matrix.avg, 1);
+
+    auto keyboard = stats(SCAN_PROFILER_KEYBOARD_TASK);
+    EXPECT_EQ(keyboard.count, 10);
+    EXPECT_EQ(keyboard.max, 5);
+
+    // Tasks that didn't take any time
+    EXPECT_EQ(stats(SCAN_PROFILER_QUANTUM_TASK).count, 10);
+    EXPECT_EQ(stats(SCAN_PROFILER_QUANTUM_TASK).max, 0);
+    EXPECT_EQ(stats(SCAN_PROFILER_CAPS_WORD_TASK).count, 10);
+    EXPECT_EQ(stats(SCAN_PROFILER_LED_TASK).count, 10);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ScanProfiler, PercentileComesFromHistogram) {
+    for (int i = 0; i < 99; i++) {
+        record(SCAN_PROFILER_QUANTUM_TASK, 1);
+    }
+    record(SCAN_PROFILER_QUANTUM_TASK, 100);
+
+    auto quantum = stats(SCAN_PROFILER_QUANTUM_TASK);
+    EXPECT_EQ(quantum.count, 100);
+    EXPECT_EQ(quantum.min, 1);
+    EXPECT_EQ(quantum.avg, 1);
+    EXPECT_EQ(quantum.max, 100);
+    EXPECT_EQ(quantum.p99, 1);
+
+    // Once more than 1% of the samples are slow, the 99th percentile is limited by the maximum instead of the bucket bound of 127
+    record(SCAN_PROFILER_QUANTUM_TASK, 100);
+    record(SCAN_PROFILER_QUANTUM_TASK, 100);
+    quantum = stats(SCAN_PROFILER_QUANTUM_TASK);
+    EXPECT_EQ(quantum.p99, 100);
+
+    scan_profiler_reset();
+    EXPECT_EQ(stats(SCAN_PROFILER_QUANTUM_TASK).count, 0);
+}
+
+TEST_F(ScanProfiler, StatsCanBeQueriedOverRawHid) {
+    record(SCAN_PROFILER_MATRIX_TASK, 3);
+    record(SCAN_PROFILER_MATRIX_TASK, 300);
+
+    uint8_t data[32] = {SCAN_PROFILER_RAW_HID_COMMAND, id_scan_profiler_get_task_count};
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], SCAN_PROFILER_TASK_COUNT);
+
+    memset(data, 0, sizeof(data));
+    data[0] = SCAN_PROFILER_RAW_HID_COMMAND;
+    data[1] = id_scan_profiler_get_stats;
+    data[2] = SCAN_PROFILER_MATRIX_TASK;
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], id_scan_profiler_get_stats);
+    uint32_t values[5];
+    memcpy(values, &data[3], sizeof(values));
+    EXPECT_EQ(values[0], 2);
+    EXPECT_EQ(values[1], 3);
+    EXPECT_EQ(values[2], 151);
+    EXPECT_EQ(values[3], 300);
+    EXPECT_EQ(values[4], 300);
+
+    data[2] = SCAN_PROFILER_TASK_COUNT;
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0xFF);
+
+    data[1] = id_scan_profiler_get_task_name;
+    data[2] = SCAN_PROFILER_CAPS_WORD_TASK;
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], id_scan_profiler_get_task_name);
+    EXPECT_STREQ((const char *)&data[3], "caps_word_task");
+
+    data[2] = SCAN_PROFILER_TASK_COUNT;
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0xFF);
+
+    data[0] = 0x01;
+    EXPECT_FALSE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+
+    data[0] = SCAN_PROFILER_RAW_HID_COMMAND;
+    data[1] = id_scan_profiler_reset;
+    EXPECT_TRUE(scan_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(stats(SCAN_PROFILER_MATRIX_TASK).count, 0);
+}
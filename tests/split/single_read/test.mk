@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_KEYBOARD = yes
+
+SRC += serial.c
+
+# The latency histogram of tests/split/transactions, with the matrix read in one round trip
+SRC += tests/split/transactions/test_matrix_latency.cpp
@@ -0,0 +1,76 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "crc.h"
+#include "serial_test.h"
+#include "transactions.h"
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+/*
+ * Runs the master half's transactions over the test platform's stand-in
+ * serial link with SPLIT_SLAVE_MATRIX_SINGLE_READ, with the slave half's
+ * matrix set by the tests.
+ */
+class SingleRead : public TestFixture {
+   protected:
+    void SetUp() override {
+        slave_matrix_set(0);
+        EXPECT_TRUE(scan());
+        serial_test_reset_counters();
+    }
+
+    /* Sets the slave's matrix, and its checksum, as the slave would. */
+    void slave_matrix_set(matrix_row_t row0) {
+        split_shared_memory_t *slave = serial_test_slave_shmem();
+        memset(slave->smatrix.matrix, 0, sizeof(slave->smatrix.matrix));
+        slave->smatrix.matrix[0] = row0;
+        slave->smatrix.checksum  = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+
+    bool scan(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    matrix_row_t master_matrix[ROWS_PER_HAND] = {0};
+    matrix_row_t slave_matrix[ROWS_PER_HAND]  = {0};
+};
+
+TEST_F(SingleRead, ChangedSlaveMatrixReadInOneRoundTrip) {
+    slave_matrix_set(0x21);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_DATA), 1);
+    EXPECT_EQ(slave_matrix[0], 0x21);
+
+    // The checksum and matrix, padding included, after the transaction ID and handshake
+    EXPECT_EQ(serial_test_bytes(GET_SLAVE_MATRIX_DATA), 2 + sizeof(split_slave_matrix_sync_t));
+    EXPECT_EQ(serial_test_total_bytes(), serial_test_bytes(GET_SLAVE_MATRIX_DATA));
+}
+
+TEST_F(SingleRead, UnchangedSlaveMatrixReadEveryScan) {
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_DATA), 3);
+    EXPECT_EQ(serial_test_bytes(GET_SLAVE_MATRIX_DATA), 3 * (2 + sizeof(split_slave_matrix_sync_t)));
+    EXPECT_EQ(slave_matrix[0], 0);
+}
+
+TEST_F(SingleRead, BadSlaveChecksumKeepsLastMatrix) {
+    slave_matrix_set(0x03);
+    EXPECT_TRUE(scan());
+
+    slave_matrix_set(0x30);
+    serial_test_slave_shmem()->smatrix.checksum ^= 0xFF;
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x03);
+
+    // The next good read is taken up straight away
+    slave_matrix_set(0x30);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x30);
+}
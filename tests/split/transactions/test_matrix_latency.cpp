@@ -0,0 +1,131 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "crc.h"
+#include "serial_test.h"
+#include "transactions.h"
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+/* Time the master spends scanning its own half, before the transactions of each scan. */
+#define LOCAL_SCAN_NS 250000ULL
+/* One byte on the link at the default SELECT_SOFT_SERIAL_SPEED, 230400 baud with 10 bits per byte. */
+#define BYTE_NS (10ULL * 1000000000ULL / 230400)
+
+#define LATENCY_SAMPLES 100
+#define HISTOGRAM_BUCKET_NS 50000ULL
+
+/*
+ * Times how long a key change on the slave half takes to reach the master,
+ * on a simulated timeline where each master scan costs LOCAL_SCAN_NS plus
+ * the bytes its transactions move over the link. The change lands at
+ * evenly spread points across an idle scan, and the master only sees the
+ * slave matrix as it was when its transactions start.
+ *
+ * tests/split/transactions runs this with the default checksum then data
+ * reads, and tests/split/single_read with SPLIT_SLAVE_MATRIX_SINGLE_READ.
+ * The histogram of latencies is recorded as properties of the JSON test
+ * report.
+ */
+class MatrixLatency : public TestFixture {
+   protected:
+    void SetUp() override {
+        slave_matrix_set(0);
+        EXPECT_TRUE(scan());
+        serial_test_reset_counters();
+    }
+
+    /* Sets the slave's matrix, and its checksum, as the slave would. */
+    void slave_matrix_set(matrix_row_t row0) {
+        split_shared_memory_t *slave = serial_test_slave_shmem();
+        memset(slave->smatrix.matrix, 0, sizeof(slave->smatrix.matrix));
+        slave->smatrix.matrix[0] = row0;
+        slave->smatrix.checksum  = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+
+    bool scan(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    /* Runs the transactions of one scan, returning the bytes they moved. */
+    uint32_t scan_bytes(void) {
+        serial_test_reset_counters();
+        EXPECT_TRUE(scan());
+        return serial_test_total_bytes();
+    }
+
+    /* Scans until a slave change made `offset_ns` into the first scan reaches the master, returning how long that took. */
+    uint64_t latency_ns(matrix_row_t row0, uint64_t offset_ns) {
+        uint64_t now     = 0;
+        bool     changed = false;
+        while (true) {
+            now += LOCAL_SCAN_NS;
+            if (!changed && now >= offset_ns) {
+                slave_matrix_set(row0);
+                changed = true;
+            }
+            now += scan_bytes() * BYTE_NS;
+            if (changed && slave_matrix[0] == row0) {
+                return now - offset_ns;
+            }
+        }
+    }
+
+    matrix_row_t master_matrix[ROWS_PER_HAND] = {0};
+    matrix_row_t slave_matrix[ROWS_PER_HAND]  = {0};
+};
+
+TEST_F(MatrixLatency, SlaveKeyChangeHistogram) {
+    uint32_t idle_bytes = scan_bytes();
+    slave_matrix_set(1);
+    uint32_t change_bytes = scan_bytes();
+    slave_matrix_set(0);
+    EXPECT_EQ(scan_bytes(), change_bytes);
+
+#ifdef SPLIT_SLAVE_MATRIX_SINGLE_READ
+    // Every scan reads the checksum and matrix together
+    EXPECT_EQ(idle_bytes, 2 + sizeof(split_slave_matrix_sync_t));
+    EXPECT_EQ(change_bytes, idle_bytes);
+#else
+    // Idle scans only read the checksum, and a change reads the matrix as well
+    EXPECT_EQ(idle_bytes, 2 + sizeof(uint8_t));
+    EXPECT_EQ(change_bytes, idle_bytes + 2 + sizeof(matrix_row_t) * ROWS_PER_HAND);
+#endif
+
+    uint64_t idle_scan_ns   = LOCAL_SCAN_NS + idle_bytes * BYTE_NS;
+    uint64_t change_scan_ns = LOCAL_SCAN_NS + change_bytes * BYTE_NS;
+
+    std::vector<uint32_t> histogram;
+    uint64_t              total = 0;
+    for (uint32_t i = 0; i < LATENCY_SAMPLES; i++) {
+        uint64_t latency = latency_ns(i & 1 ? 0 : 1, i * idle_scan_ns / LATENCY_SAMPLES);
+
+        // Seen by the transactions of the next scan, however late in the current scan the change lands
+        EXPECT_GT(latency, change_bytes * BYTE_NS);
+        EXPECT_LE(latency, idle_scan_ns + change_scan_ns);
+
+        uint32_t bucket = latency / HISTOGRAM_BUCKET_NS;
+        if (bucket >= histogram.size()) {
+            histogram.resize(bucket + 1);
+        }
+        histogram[bucket]++;
+        total += latency;
+    }
+
+    RecordProperty("idle_bytes_per_scan", std::to_string(idle_bytes));
+    RecordProperty("change_bytes_per_scan", std::to_string(change_bytes));
+    RecordProperty("mean_latency_us", std::to_string(total / LATENCY_SAMPLES / 1000));
+    for (uint32_t bucket = 0; bucket < histogram.size(); bucket++) {
+        if (!histogram[bucket]) {
+            continue;
+        }
+        RecordProperty("latency_us_" + std::to_string(bucket * HISTOGRAM_BUCKET_NS / 1000), std::to_string(histogram[bucket]));
+    }
+}
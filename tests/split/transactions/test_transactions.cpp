@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "crc.h"
+#include "serial_test.h"
+#include "transactions.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+/*
+ * Runs the master half's transactions over the test platform's stand-in
+ * serial link, with the slave half's matrix set by the tests.
+ */
+class Transactions : public TestFixture {
+   protected:
+    void SetUp() override {
+        slave_matrix_set(0);
+        layer_clear();
+        default_layer_set(1);
+
+        // Settle on the initial state, and let any forced resync pass
+        advance_time(FORCED_SYNC_THROTTLE_MS);
+        EXPECT_TRUE(scan());
+        serial_test_reset_counters();
+    }
+
+    /* Sets the slave's matrix, and its checksum, as the slave would. */
+    void slave_matrix_set(matrix_row_t row0) {
+        split_shared_memory_t *slave = serial_test_slave_shmem();
+        memset(slave->smatrix.matrix, 0, sizeof(slave->smatrix.matrix));
+        slave->smatrix.matrix[0] = row0;
+        slave->smatrix.checksum  = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+
+    bool scan(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    matrix_row_t master_matrix[ROWS_PER_HAND] = {0};
+    matrix_row_t slave_matrix[ROWS_PER_HAND]  = {0};
+};
+
+TEST_F(Transactions, UnchangedSlaveMatrixOnlyReadsChecksum) {
+    slave_matrix_set(0x05);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x05);
+    serial_test_reset_counters();
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_CHECKSUM), 1);
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_DATA), 0);
+    EXPECT_EQ(slave_matrix[0], 0x05);
+
+    // Only the checksum byte after the transaction ID and handshake
+    EXPECT_EQ(serial_test_bytes(GET_SLAVE_MATRIX_CHECKSUM), 2 + sizeof(uint8_t));
+    EXPECT_EQ(serial_test_total_bytes(), serial_test_bytes(GET_SLAVE_MATRIX_CHECKSUM));
+}
+
+TEST_F(Transactions, ChangedSlaveMatrixReadInTwoRoundTrips) {
+    slave_matrix_set(0x21);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_CHECKSUM), 1);
+    EXPECT_EQ(serial_test_transactions(GET_SLAVE_MATRIX_DATA), 1);
+    EXPECT_EQ(slave_matrix[0], 0x21);
+    EXPECT_EQ(serial_test_bytes(GET_SLAVE_MATRIX_CHECKSUM), 2 + sizeof(uint8_t));
+    EXPECT_EQ(serial_test_bytes(GET_SLAVE_MATRIX_DATA), 2 + sizeof(matrix_row_t) * ROWS_PER_HAND);
+}
+
+TEST_F(Transactions, BadSlaveChecksumKeepsLastMatrix) {
+    slave_matrix_set(0x03);
+    EXPECT_TRUE(scan());
+
+    slave_matrix_set(0x30);
+    serial_test_slave_shmem()->smatrix.checksum ^= 0xFF;
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x03);
+}
+
+TEST_F(Transactions, LayerStatesSentTogether) {
+    // Both layer states changing only costs a single transaction
+    layer_on(2);
+    default_layer_set(1 << 1);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(PUT_LAYER_STATE), 1);
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE), 2 + sizeof(split_layers_sync_t));
+    EXPECT_EQ(serial_test_total_bytes(), serial_test_bytes(GET_SLAVE_MATRIX_CHECKSUM) + serial_test_bytes(PUT_LAYER_STATE));
+    // A transaction ID and handshake less than sending each layer state on its own
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE) + 2, 2 * (2 + sizeof(layer_state_t)));
+    EXPECT_EQ(serial_test_slave_shmem()->layers.layer_state, (layer_state_t)1 << 2);
+    EXPECT_EQ(serial_test_slave_shmem()->layers.default_layer_state, (layer_state_t)1 << 1);
+
+    // Just the default layer changing sends the current layer state along with it
+    default_layer_set(1 << 0);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(PUT_LAYER_STATE), 2);
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE), 2 * (2 + sizeof(split_layers_sync_t)));
+    EXPECT_EQ(serial_test_slave_shmem()->layers.layer_state, (layer_state_t)1 << 2);
+    EXPECT_EQ(serial_test_slave_shmem()->layers.default_layer_state, (layer_state_t)1 << 0);
+}
+
+TEST_F(Transactions, UnchangedLayerStatesResentWhenThrottleElapses) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(PUT_LAYER_STATE), 0);
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE), 0);
+
+    advance_time(FORCED_SYNC_THROTTLE_MS - 1);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(PUT_LAYER_STATE), 0);
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE), 0);
+
+    // Both layer states are resent together, as one transaction
+    advance_time(1);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_test_transactions(PUT_LAYER_STATE), 1);
+    EXPECT_EQ(serial_test_bytes(PUT_LAYER_STATE), 2 + sizeof(split_layers_sync_t));
+}
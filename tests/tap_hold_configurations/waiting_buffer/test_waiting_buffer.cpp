@@ -0,0 +1,153 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class WaitingBuffer : public TestFixture {
+   protected:
+    struct KeyEvent {
+        uint32_t time;
+        size_t   key;
+        bool     pressed;
+    };
+
+    std::vector<KeymapKey> keys;
+    std::string            chars;
+    std::string            typed;
+    std::vector<uint8_t>   held;
+    bool                   mods_seen = false;
+
+    void SetUp() override {
+        // clang-format off
+        const char *rows[] = {"qwertyuiop", "asdfghjkl;", "zxcvbnm,./"};
+        const uint16_t codes[][10] = {
+            {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P},
+            {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G, KC_H, RSFT_T(KC_J), RCTL_T(KC_K), LALT_T(KC_L), RGUI_T(KC_SCLN)},
+            {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH},
+        };
+        // clang-format on
+        for (uint8_t row = 0; row < 3; row++) {
+            for (uint8_t col = 0; col < 10; col++) {
+                keys.emplace_back(0, col, row, codes[row][col]);
+                chars.push_back(rows[row][col]);
+                add_key(keys.back());
+            }
+        }
+    }
+
+    KeymapKey &key_for(char c) {
+        return keys[chars.find(c)];
+    }
+
+    char char_for(uint8_t keycode) {
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (QK_MOD_TAP_GET_TAP_KEYCODE(keys[i].code) == keycode || keys[i].code == keycode) {
+                return chars[i];
+            }
+        }
+        return '?';
+    }
+
+    /* Records every key that newly appears in a report, in order. */
+    void capture_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            std::vector<uint8_t> now;
+            for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+                if (report.keys[i] != KC_NO) {
+                    now.push_back(report.keys[i]);
+                    if (std::find(held.begin(), held.end(), report.keys[i]) == held.end()) {
+                        typed.push_back(char_for(report.keys[i]));
+                    }
+                }
+            }
+            held = now;
+            mods_seen |= report.mods != 0;
+        }));
+    }
+
+    /* Types text with a fixed press interval and hold duration, scanning once per millisecond. */
+    void type_rolling(const std::string &text, uint32_t interval, uint32_t hold) {
+        std::vector<KeyEvent> events;
+        for (size_t i = 0; i < text.size(); i++) {
+            size_t key = chars.find(text[i]);
+            events.push_back({(uint32_t)(i * interval), key, true});
+            events.push_back({(uint32_t)(i * interval + hold), key, false});
+        }
+        std::stable_sort(events.begin(), events.end(), [](const KeyEvent &a, const KeyEvent &b) { return a.time < b.time; });
+
+        uint32_t now = 0;
+        for (auto &event : events) {
+            if (event.time > now) {
+                idle_for(event.time - now);
+                now = event.time;
+            }
+            if (event.pressed) {
+                keys[event.key].press();
+            } else {
+                keys[event.key].release();
+            }
+        }
+        idle_for(TAPPING_TERM * 2);
+    }
+};
+
+TEST_F(WaitingBuffer, many_taps_while_mod_tap_key_is_held_within_tapping_term) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    const std::string text = "qwertyuiopzx";
+    static_assert(2 * 12 <= WAITING_BUFFER_SIZE, "test needs a larger waiting buffer");
+
+    /* Press mod-tap-hold key and tap twelve keys, more events than the default buffer holds. */
+    key_for('f').press();
+    run_one_scan_loop();
+    for (char c : text) {
+        tap_key(key_for(c));
+    }
+    EXPECT_EQ(typed, "");
+
+    /* Release mod-tap-hold key within the tapping term, everything is replayed as taps. */
+    key_for('f').release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, "f" + text);
+    EXPECT_FALSE(mods_seen);
+}
+
+TEST_F(WaitingBuffer, home_row_mods_rolling_at_200_wpm) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    const std::string text = "kidsflashjokesdaily";
+    type_rolling(text, 60, 100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, text);
+    EXPECT_FALSE(mods_seen);
+}
+
+TEST_F(WaitingBuffer, home_row_mods_rolling_burst) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    const std::string text = "flashydocument";
+    type_rolling(text, 10, 45);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, text);
+    EXPECT_FALSE(mods_seen);
+}
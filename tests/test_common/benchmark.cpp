@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include "keycode.h"
+
+static unsigned long benchmark_iterations(void) {
+    const char* iterations = std::getenv("QMK_BENCHMARK_ITERATIONS");
+    return iterations ? std::strtoul(iterations, nullptr, 10) : 3;
+}
+
+BenchmarkFixture::BenchmarkFixture() : iterations(benchmark_iterations()) {
+    record("iterations", iterations);
+}
+
+BenchmarkDriver* BenchmarkDriver::m_this = nullptr;
+
+BenchmarkDriver::BenchmarkDriver() : m_driver{&BenchmarkDriver::keyboard_leds, &BenchmarkDriver::send_keyboard, &BenchmarkDriver::send_nkro, &BenchmarkDriver::send_mouse, &BenchmarkDriver::send_extra} {
+    host_set_driver(&m_driver);
+    m_this = this;
+}
+
+BenchmarkDriver::~BenchmarkDriver() {
+    m_this = nullptr;
+}
+
+bool BenchmarkDriver::last_keyboard_report_empty(void) const {
+    if (last_keyboard_report.mods != 0) {
+        return false;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (last_keyboard_report.keys[i] != KC_NO) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint8_t BenchmarkDriver::keyboard_leds(void) {
+    return 0;
+}
+
+void BenchmarkDriver::send_keyboard(report_keyboard_t* report) {
+    m_this->keyboard_reports++;
+    m_this->last_keyboard_report = *report;
+    if (m_this->on_keyboard_report) {
+        m_this->on_keyboard_report(*report);
+    }
+}
+
+void BenchmarkDriver::send_nkro(report_nkro_t* report) {}
+
+void BenchmarkDriver::send_mouse(report_mouse_t* report) {}
+
+void BenchmarkDriver::send_extra(report_extra_t* report) {}
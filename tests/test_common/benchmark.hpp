@@ -0,0 +1,99 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "gtest/gtest.h"
+#include "host.h"
+#include "test_fixture.hpp"
+#include "test_logger.hpp"
+
+/**
+ * @brief Test fixture for the benchmarks below tests/benchmark.
+ *
+ * As part of `make test`, each workload only runs a few times as a smoke
+ * test. `make benchmark:...` sets QMK_BENCHMARK_ITERATIONS, and the results
+ * recorded with record() end up as properties of the JSON test report.
+ */
+class BenchmarkFixture : public TestFixture {
+   public:
+    BenchmarkFixture();
+
+    /**
+     * @brief Returns how long `work` takes to run once, in nanoseconds.
+     */
+    template <typename Work>
+    static uint64_t time_ns(Work work) {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Runs `workload` `iterations` times, returning the total time taken in nanoseconds.
+     *
+     * The test log is cleared after every iteration, as it would otherwise
+     * grow with every scan loop.
+     */
+    template <typename Workload>
+    uint64_t time_iterations(Workload workload) {
+        test_logger.reset();
+        return time_ns([&] {
+            for (unsigned long i = 0; i < iterations; i++) {
+                workload();
+                test_logger.reset();
+            }
+        });
+    }
+
+    /**
+     * @brief Divides a total by a count, for the time taken per item, or 0 if nothing was counted.
+     */
+    static uint64_t per(uint64_t total, uint64_t count) {
+        return count ? total / count : 0;
+    }
+
+    void record(const std::string& name, uint64_t value) {
+        RecordProperty(name, std::to_string(value));
+    }
+
+    void record(const std::string& name, const char* value) {
+        RecordProperty(name, value);
+    }
+
+    /** QMK_BENCHMARK_ITERATIONS, or 3 when run by `make test`. */
+    const unsigned long iterations;
+};
+
+/**
+ * @brief Host driver counting the reports sent.
+ *
+ * It stands in for TestDriver, so that gmock's expectation matching isn't
+ * part of the time measured.
+ */
+class BenchmarkDriver {
+   public:
+    BenchmarkDriver();
+    ~BenchmarkDriver();
+
+    bool last_keyboard_report_empty(void) const;
+
+    uint64_t          keyboard_reports     = 0;
+    report_keyboard_t last_keyboard_report = {};
+
+    /** Called with every keyboard report, for the tests to count what they are interested in. */
+    std::function<void(const report_keyboard_t&)> on_keyboard_report;
+
+   private:
+    static uint8_t          keyboard_leds(void);
+    static void             send_keyboard(report_keyboard_t* report);
+    static void             send_nkro(report_nkro_t* report);
+    static void             send_mouse(report_mouse_t* report);
+    static void             send_extra(report_extra_t* report);
+    host_driver_t           m_driver;
+    static BenchmarkDriver* m_this;
+};
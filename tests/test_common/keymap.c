@@ -16,18 +16,7 @@
 
 #include "quantum.h"
 
-// clang-format off
-
-const uint16_t PROGMEM
-               keymaps[][MATRIX_ROWS][MATRIX_COLS] =
-        {
-            [0] =
-                {
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                },
+// Every key is KC_NO, whatever size the test's config.h gives the matrix
+const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [0] = {{KC_NO}},
 };
-
-// clang-format on
@@ -104,6 +104,11 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE_ENABLE)
+    /* The keymap contents changed, previously resolved layers may be stale. */
+    layer_resolution_cache_clear();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -74,6 +74,30 @@ static void obnotify(io_buffers_queue_t *bqp) {
     }
 }
 
+/**
+ * @brief   Starts transmitting the oldest queued report, unless a transaction
+ *          is already ongoing on the endpoint.
+ *
+ * @param[in] endpoint  the IN endpoint with a report queue.
+ */
+static void usb_start_report_transmit(usb_endpoint_in_t *endpoint) {
+    /* If the USB endpoint is not in the appropriate state then transactions
+       must not be started.*/
+    if ((usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE)) {
+        return;
+    }
+
+    if (usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep)) {
+        return;
+    }
+
+    uint8_t  size;
+    uint8_t *report = usb_report_queue_next(endpoint->report_queue, &size);
+    if (report != NULL) {
+        usbStartTransmitI(endpoint->config.usbp, endpoint->config.ep, report, size);
+    }
+}
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -124,6 +148,9 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint) {
 
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+    if (endpoint->report_queue != NULL) {
+        usb_report_queue_reset(endpoint->report_queue);
+    }
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -147,6 +174,10 @@ void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint) {
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
 
+    if (endpoint->report_queue != NULL) {
+        usb_report_queue_reset(endpoint->report_queue);
+    }
+
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -169,6 +200,9 @@ void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint) {
     usbInitEndpointI(endpoint->config.usbp, endpoint->config.ep, &endpoint->ep_config);
     obqResetI(&endpoint->obqueue);
     bqResumeX(&endpoint->obqueue);
+    if (endpoint->report_queue != NULL) {
+        usb_report_queue_reset(endpoint->report_queue);
+    }
 }
 
 void usb_endpoint_out_configure_cb(usb_endpoint_out_t *endpoint) {
@@ -197,6 +231,20 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Sending succeded, so we can reset the timed out state. */
     endpoint->timed_out = false;
 
+    if (endpoint->report_queue != NULL) {
+        /* Store the last send report in the endpoint to be retrieved by a
+         * GET_REPORT request or IDLE report handling, then move on to the
+         * next queued report. */
+        uint8_t size;
+        buffer = usb_report_queue_complete(endpoint->report_queue, &size);
+        if (buffer != NULL && endpoint->report_storage != NULL) {
+            endpoint->report_storage->set_report(endpoint->report_storage->reports, buffer, size);
+        }
+        usb_start_report_transmit(endpoint);
+        osalSysUnlockFromISR();
+        return;
+    }
+
     /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
     if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
         /* Store the last send report in the endpoint to be retrieved by a
@@ -291,6 +339,29 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
 }
 
+/**
+ * @brief Queues a report for transmission without waiting for the host. If
+ * the host hasn't picked up earlier reports yet, the report may be merged
+ * into a pending one as described in usb_report_queue.h.
+ *
+ * @return false if the endpoint isn't active or the report was dropped
+ */
+bool usb_endpoint_in_send_report(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, usb_report_merge_t merge, uint8_t type) {
+    osalDbgCheck((endpoint != NULL) && (endpoint->report_queue != NULL) && (data != NULL) && (size > 0U) && (size <= endpoint->config.buffer_size));
+
+    osalSysLock();
+    if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) {
+        osalSysUnlock();
+        return false;
+    }
+
+    usb_report_queue_result_t result = usb_report_queue_push(endpoint->report_queue, data, size, merge, type);
+    usb_start_report_transmit(endpoint);
+    osalSysUnlock();
+
+    return result != USB_REPORT_DROPPED;
+}
+
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     osalDbgCheck(endpoint != NULL);
 
@@ -315,6 +386,9 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
 
     osalSysLock();
     bool inactive = obqIsEmptyI(&endpoint->obqueue) && !usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep);
+    if (endpoint->report_queue != NULL) {
+        inactive &= usb_report_queue_is_empty(endpoint->report_queue);
+    }
     osalSysUnlock();
 
     return inactive;
@@ -54,6 +54,7 @@ extern keymap_config_t keymap_config;
 extern usb_endpoint_in_t  usb_endpoints_in[USB_ENDPOINT_IN_COUNT];
 extern usb_endpoint_out_t usb_endpoints_out[USB_ENDPOINT_OUT_COUNT];
 
+static bool send_report_merged(usb_endpoint_in_lut_t endpoint, void *report, size_t size, usb_report_merge_t merge, uint8_t type);
 static bool __attribute__((__unused__)) send_report_buffered(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 static void __attribute__((__unused__)) flush_report_buffered(usb_endpoint_in_lut_t endpoint, bool padded);
 static bool __attribute__((__unused__)) receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t size);
@@ -395,6 +396,16 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  * ---------------------------------------------------------
  */
 
+/* Reports on the shared endpoint start with their report ID, which tells the different report types apart. */
+static inline uint8_t report_type(usb_endpoint_in_lut_t endpoint, void *report) {
+#if defined(SHARED_EP_ENABLE)
+    if (endpoint == USB_ENDPOINT_IN_SHARED) {
+        return ((uint8_t *)report)[0];
+    }
+#endif
+    return 0;
+}
+
 /**
  * @brief Send a report to the host, the report is enqueued into an output
  * queue and send once the USB endpoint becomes empty.
@@ -406,9 +417,46 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  * @return false Failure
  */
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
+    return send_report_merged(endpoint, report, size, USB_REPORT_MERGE_STATE, report_type(endpoint, report));
+}
+
+/**
+ * @brief Send a report to the host. On endpoints with a report queue this
+ * doesn't wait for the host, instead the report may be merged into a pending
+ * report of the same type, see usb_report_queue.h. Otherwise this is the same
+ * as `send_report`.
+ *
+ * @param endpoint USB IN endpoint to send the report from
+ * @param report pointer to the report
+ * @param size size of the report
+ * @param merge how the report may be merged into pending reports
+ * @param type reports are only merged with pending reports of the same type
+ * @return true Success
+ * @return false Failure
+ */
+static bool send_report_merged(usb_endpoint_in_lut_t endpoint, void *report, size_t size, usb_report_merge_t merge, uint8_t type) {
+    if (usb_endpoints_in[endpoint].report_queue != NULL) {
+        return usb_endpoint_in_send_report(&usb_endpoints_in[endpoint], (uint8_t *)report, size, merge, type);
+    }
     return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
 }
 
+/**
+ * @brief Get the number of queued, merged and dropped reports of an endpoint.
+ * These are all zero unless USB_REPORT_QUEUE_ENABLE is defined.
+ *
+ * @param endpoint USB IN endpoint to get the statistics of
+ */
+usb_report_queue_stats_t get_usb_report_queue_stats(usb_endpoint_in_lut_t endpoint) {
+    usb_report_queue_stats_t stats = {0};
+    if (usb_endpoints_in[endpoint].report_queue != NULL) {
+        osalSysLock();
+        stats = usb_endpoints_in[endpoint].report_queue->stats;
+        osalSysUnlock();
+    }
+    return stats;
+}
+
 /**
  * @brief Send a report to the host, but delay the sending until the size of
  * endpoint report is reached or the incompletely filled buffer is flushed with
@@ -453,7 +501,7 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        send_report_merged(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8, USB_REPORT_MERGE_STATE, 0);
     } else {
         send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
     }
@@ -472,7 +520,7 @@ void send_nkro(report_nkro_t *report) {
 
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
+    send_report_merged(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t), USB_REPORT_MERGE_MOUSE, report_type(USB_ENDPOINT_IN_MOUSE, report));
 #endif
 }
 
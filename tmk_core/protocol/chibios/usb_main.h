@@ -34,6 +34,9 @@ void restart_usb_driver(USBDriver *usbp);
 
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 
+/* Get the number of queued, merged and dropped reports of an endpoint with USB_REPORT_QUEUE_ENABLE */
+usb_report_queue_stats_t get_usb_report_queue_stats(usb_endpoint_in_lut_t endpoint);
+
 /* ---------------
  * USB Event queue
  * ---------------
@@ -0,0 +1,178 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "usb_report_queue.h"
+#include "report.h"
+
+typedef struct {
+    uint8_t size;
+    uint8_t type;
+    uint8_t merge;
+    uint8_t reserved;
+    uint8_t data[];
+} usb_report_queue_slot_t;
+
+#ifdef MOUSE_EXTENDED_REPORT
+#    define USB_REPORT_QUEUE_XY_MIN INT16_MIN
+#    define USB_REPORT_QUEUE_XY_MAX INT16_MAX
+#else
+#    define USB_REPORT_QUEUE_XY_MIN INT8_MIN
+#    define USB_REPORT_QUEUE_XY_MAX INT8_MAX
+#endif
+
+#ifdef WHEEL_EXTENDED_REPORT
+#    define USB_REPORT_QUEUE_HV_MIN INT16_MIN
+#    define USB_REPORT_QUEUE_HV_MAX INT16_MAX
+#else
+#    define USB_REPORT_QUEUE_HV_MIN INT8_MIN
+#    define USB_REPORT_QUEUE_HV_MAX INT8_MAX
+#endif
+
+#define USB_REPORT_QUEUE_FITS(value, min, max) ((value) >= (min) && (value) <= (max))
+
+static usb_report_queue_slot_t *usb_report_queue_slot(usb_report_queue_t *queue, uint8_t index) {
+    return (usb_report_queue_slot_t *)&queue->buffer[((queue->head + index) % queue->capacity) * queue->stride];
+}
+
+/* Sums the motion of a mouse report into a pending one, if the buttons match and the result doesn't overflow. */
+static bool usb_report_queue_merge_mouse(uint8_t *pending, const uint8_t *report) {
+    report_mouse_t *      a = (report_mouse_t *)pending;
+    const report_mouse_t *b = (const report_mouse_t *)report;
+
+    if (a->buttons != b->buttons) {
+        return false;
+    }
+
+    int32_t x = (int32_t)a->x + b->x;
+    int32_t y = (int32_t)a->y + b->y;
+    int32_t v = (int32_t)a->v + b->v;
+    int32_t h = (int32_t)a->h + b->h;
+    if (!USB_REPORT_QUEUE_FITS(x, USB_REPORT_QUEUE_XY_MIN, USB_REPORT_QUEUE_XY_MAX) || !USB_REPORT_QUEUE_FITS(y, USB_REPORT_QUEUE_XY_MIN, USB_REPORT_QUEUE_XY_MAX) || !USB_REPORT_QUEUE_FITS(v, USB_REPORT_QUEUE_HV_MIN, USB_REPORT_QUEUE_HV_MAX) || !USB_REPORT_QUEUE_FITS(h, USB_REPORT_QUEUE_HV_MIN, USB_REPORT_QUEUE_HV_MAX)) {
+        return false;
+    }
+
+    a->x = x;
+    a->y = y;
+    a->v = v;
+    a->h = h;
+#ifdef MOUSE_EXTENDED_REPORT
+    a->boot_x = x < INT8_MIN ? INT8_MIN : (x > INT8_MAX ? INT8_MAX : x);
+    a->boot_y = y < INT8_MIN ? INT8_MIN : (y > INT8_MAX ? INT8_MAX : y);
+#endif
+    return true;
+}
+
+/*
+ * Finds the oldest pending report which is followed by a later report of the
+ * same type, either pending or the one being pushed, returning its index or
+ * the queue count if there is none. The last pending report of each type is
+ * never dropped, so e.g. a key release can't be lost to reports of another type.
+ */
+static uint8_t usb_report_queue_superseded(usb_report_queue_t *queue, uint8_t first, uint8_t type) {
+    for (uint8_t i = first; i < queue->count; i++) {
+        uint8_t pending_type = usb_report_queue_slot(queue, i)->type;
+        if (pending_type == type) {
+            return i;
+        }
+        for (uint8_t j = i + 1; j < queue->count; j++) {
+            if (usb_report_queue_slot(queue, j)->type == pending_type) {
+                return i;
+            }
+        }
+    }
+    return queue->count;
+}
+
+void usb_report_queue_init(usb_report_queue_t *queue, uint8_t *buffer, uint8_t capacity, uint8_t report_size) {
+    memset(queue, 0, sizeof(usb_report_queue_t));
+    queue->buffer   = buffer;
+    queue->stride   = USB_REPORT_QUEUE_SLOT_SIZE(report_size);
+    queue->capacity = capacity;
+}
+
+void usb_report_queue_reset(usb_report_queue_t *queue) {
+    queue->head      = 0;
+    queue->count     = 0;
+    queue->in_flight = false;
+}
+
+usb_report_queue_result_t usb_report_queue_push(usb_report_queue_t *queue, const uint8_t *report, uint8_t size, usb_report_merge_t merge, uint8_t type) {
+    if (size > queue->stride - sizeof(usb_report_queue_slot_t)) {
+        queue->stats.dropped++;
+        return USB_REPORT_DROPPED;
+    }
+
+    // The report being transmitted can't be touched, only the ones after it
+    uint8_t first = queue->in_flight ? 1 : 0;
+    bool    full  = queue->count == queue->capacity;
+
+    if (merge != USB_REPORT_MERGE_NONE) {
+        for (uint8_t i = queue->count; i > first; i--) {
+            usb_report_queue_slot_t *slot = usb_report_queue_slot(queue, i - 1);
+            if (slot->merge != merge || slot->type != type || slot->size != size) {
+                continue;
+            }
+            if (merge == USB_REPORT_MERGE_MOUSE && size == sizeof(report_mouse_t) && usb_report_queue_merge_mouse(slot->data, report)) {
+                queue->stats.merged++;
+                return USB_REPORT_MERGED;
+            }
+            if (merge == USB_REPORT_MERGE_STATE && full) {
+                memcpy(slot->data, report, size);
+                queue->stats.merged++;
+                return USB_REPORT_MERGED;
+            }
+            break;
+        }
+    }
+
+    if (full) {
+        uint8_t victim = usb_report_queue_superseded(queue, first, type);
+        if (victim >= queue->count) {
+            queue->stats.dropped++;
+            return USB_REPORT_DROPPED;
+        }
+        // Make room by dropping the superseded report
+        for (uint8_t i = victim; i + 1 < queue->count; i++) {
+            memcpy(usb_report_queue_slot(queue, i), usb_report_queue_slot(queue, i + 1), queue->stride);
+        }
+        queue->count--;
+        queue->stats.dropped++;
+    }
+
+    usb_report_queue_slot_t *slot = usb_report_queue_slot(queue, queue->count);
+    slot->size                    = size;
+    slot->type                    = type;
+    slot->merge                   = merge;
+    memcpy(slot->data, report, size);
+    queue->count++;
+    queue->stats.queued++;
+    return USB_REPORT_QUEUED;
+}
+
+uint8_t *usb_report_queue_next(usb_report_queue_t *queue, uint8_t *size) {
+    if (queue->in_flight || queue->count == 0) {
+        return NULL;
+    }
+    usb_report_queue_slot_t *slot = usb_report_queue_slot(queue, 0);
+    queue->in_flight              = true;
+    *size                         = slot->size;
+    return slot->data;
+}
+
+uint8_t *usb_report_queue_complete(usb_report_queue_t *queue, uint8_t *size) {
+    if (!queue->in_flight) {
+        return NULL;
+    }
+    // The slot stays intact until the next push, so the report can still be stored for GET_REPORT
+    usb_report_queue_slot_t *slot = usb_report_queue_slot(queue, 0);
+    queue->head                   = (queue->head + 1) % queue->capacity;
+    queue->count--;
+    queue->in_flight = false;
+    *size            = slot->size;
+    return slot->data;
+}
+
+bool usb_report_queue_is_empty(usb_report_queue_t *queue) {
+    return queue->count == 0;
+}
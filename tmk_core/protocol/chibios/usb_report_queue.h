@@ -0,0 +1,77 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Small ring of pending IN reports for a single USB endpoint.
+ *
+ * Reports are queued without blocking, and transmitted one at a time in
+ * order. The oldest report is handed out for transmission by
+ * `usb_report_queue_next` and stays in the queue untouched until
+ * `usb_report_queue_complete` is called. When the host hasn't polled for a
+ * while, newer reports are merged into pending ones of the same type instead
+ * of stalling the caller:
+ *
+ * - State reports (keyboard, NKRO, extrakeys...) describe the complete
+ *   state, so once the queue is full, the newest pending report of the same
+ *   type is replaced.
+ * - Relative mouse reports have their motion summed into the newest pending
+ *   mouse report, as long as the buttons are unchanged.
+ *
+ * If neither applies to a full queue, the oldest pending report that a later
+ * report of the same type supersedes is dropped. The last pending report of a
+ * type is never dropped, if every pending report is the last of its type the
+ * new report is dropped instead.
+ * The queue does no locking of its own, the caller has to serialise access
+ * between the transfer complete interrupt and the main loop.
+ */
+
+typedef enum {
+    USB_REPORT_MERGE_NONE,
+    USB_REPORT_MERGE_STATE,
+    USB_REPORT_MERGE_MOUSE,
+} usb_report_merge_t;
+
+typedef enum {
+    USB_REPORT_QUEUED,
+    USB_REPORT_MERGED,
+    USB_REPORT_DROPPED,
+} usb_report_queue_result_t;
+
+typedef struct {
+    uint32_t queued;
+    uint32_t merged;
+    uint32_t dropped;
+} usb_report_queue_stats_t;
+
+typedef struct {
+    uint8_t *                buffer;
+    uint8_t                  stride;
+    uint8_t                  capacity;
+    uint8_t                  head;
+    uint8_t                  count;
+    bool                     in_flight;
+    usb_report_queue_stats_t stats;
+} usb_report_queue_t;
+
+/* Each slot holds a 4 byte header followed by the report, keeping reports word aligned for the USB peripheral */
+#define USB_REPORT_QUEUE_SLOT_SIZE(_report_size) (4 + (((_report_size) + 3) & ~3))
+#define USB_REPORT_QUEUE_BUFFER_SIZE(_capacity, _report_size) ((_capacity)*USB_REPORT_QUEUE_SLOT_SIZE(_report_size))
+
+#define QMK_USB_REPORT_QUEUE(_capacity, _report_size)                                                \
+    &((usb_report_queue_t){                                                                          \
+        .buffer   = (_Alignas(4) uint8_t[USB_REPORT_QUEUE_BUFFER_SIZE(_capacity, _report_size)]){0}, \
+        .stride   = USB_REPORT_QUEUE_SLOT_SIZE(_report_size),                                        \
+        .capacity = _capacity,                                                                       \
+    })
+
+void                      usb_report_queue_init(usb_report_queue_t *queue, uint8_t *buffer, uint8_t capacity, uint8_t report_size);
+void                      usb_report_queue_reset(usb_report_queue_t *queue);
+usb_report_queue_result_t usb_report_queue_push(usb_report_queue_t *queue, const uint8_t *report, uint8_t size, usb_report_merge_t merge, uint8_t type);
+uint8_t *                 usb_report_queue_next(usb_report_queue_t *queue, uint8_t *size);
+uint8_t *                 usb_report_queue_complete(usb_report_queue_t *queue, uint8_t *size);
+bool                      usb_report_queue_is_empty(usb_report_queue_t *queue);
@@ -23,37 +23,83 @@
 #include "util.h"
 #include <string.h>
 
+#ifdef NKRO_ENABLE
+/* 8 bit AVR has no 32 bit registers, and libgcc's 32 bit ctz and popcount are out of line calls, so the bitmap is scanned a byte
+ * at a time there. Defining NKRO_BITMAP_BYTE_WIDE selects the same on other targets. */
+#    if defined(__AVR__) && !defined(NKRO_BITMAP_BYTE_WIDE)
+#        define NKRO_BITMAP_BYTE_WIDE
+#    endif
+
+/* Number of keys set in nkro_report, maintained by add_key_to_report, del_key_from_report and clear_keys_from_report */
+static uint8_t nkro_key_count = 0;
+
+#    ifndef NKRO_BITMAP_BYTE_WIDE
+#        if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#            error "The NKRO bitmap helpers expect a little endian target"
+#        endif
+
+#        define NKRO_REPORT_WORDS ((NKRO_REPORT_BITS + 3) / 4)
+
+/** \brief Reads a 32 bit word of the NKRO bitmap
+ *
+ * The bitmap follows the report ID and modifiers in a packed report, so it isn't word aligned. Keycode `n` ends up at bit `n % 32` of
+ * word `n / 32`, the last word is zero padded.
+ */
+static uint32_t nkro_bits_word(const report_nkro_t* nkro_report, uint8_t index) {
+    uint32_t word   = 0;
+    uint8_t  offset = index * 4;
+    if (offset + 4 <= NKRO_REPORT_BITS) {
+        // A constant size, so it compiles to a single load rather than a call to memcpy
+        memcpy(&word, &nkro_report->bits[offset], 4);
+    } else {
+        memcpy(&word, &nkro_report->bits[offset], NKRO_REPORT_BITS - offset);
+    }
+    return word;
+}
+#    endif
+#endif
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys in the current report, excluding modifiers.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_key_count;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
+    uint8_t cnt = 0;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i]) cnt++;
     }
     return cnt;
 }
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns the first key in the current report, which is the lowest keycode when using NKRO, or KC_NO if no key is pressed.
  */
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+#    ifdef NKRO_BITMAP_BYTE_WIDE
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            uint8_t bits = nkro_report->bits[i];
+            if (bits) {
+                // biton() finds the highest bit, so isolate the lowest
+                return i << 3 | biton(bits & -bits);
+            }
+        }
+#    else
+        for (uint8_t i = 0; i < NKRO_REPORT_WORDS; i++) {
+            uint32_t word = nkro_bits_word(nkro_report, i);
+            if (word) {
+                return i << 5 | __builtin_ctzl(word);
+            }
+        }
+#    endif
+        return KC_NO;
     }
 #endif
     return keyboard_report->keys[0];
@@ -122,27 +168,57 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef NKRO_ENABLE
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Sets the bit of a key in the NKRO bitmap, returning true if it wasn't set already.
  */
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        uint8_t mask = 1 << (code & 7);
+        bool    set  = !(nkro_report->bits[code >> 3] & mask);
+        nkro_report->bits[code >> 3] |= mask;
+        return set;
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
+        return false;
     }
 }
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Clears the bit of a key in the NKRO bitmap, returning true if it was set.
  */
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        uint8_t mask    = 1 << (code & 7);
+        bool    cleared = nkro_report->bits[code >> 3] & mask;
+        nkro_report->bits[code >> 3] &= ~mask;
+        return cleared;
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
+        return false;
     }
 }
+
+/** \brief Counts the keys set in an NKRO bitmap
+ */
+uint8_t count_key_bits(report_nkro_t* nkro_report) {
+    uint8_t count = 0;
+#    ifdef NKRO_BITMAP_BYTE_WIDE
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        // Clears the lowest set bit each time round
+        for (uint8_t bits = nkro_report->bits[i]; bits; bits &= bits - 1) {
+            count++;
+        }
+    }
+#    else
+    for (uint8_t i = 0; i < NKRO_REPORT_WORDS; i++) {
+        // Few keys are held at once, and popcount is a libgcc call on Cortex-M, so clear the lowest set bit each time round
+        for (uint32_t word = nkro_bits_word(nkro_report, i); word; word &= word - 1) {
+            count++;
+        }
+    }
+#    endif
+    return count;
+}
 #endif
 
 /** \brief add key to report
@@ -152,7 +228,9 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 void add_key_to_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+        if (add_key_bit(nkro_report, key)) {
+            nkro_key_count++;
+        }
         return;
     }
 #endif
@@ -166,7 +244,9 @@ void add_key_to_report(uint8_t key) {
 void del_key_from_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+        if (del_key_bit(nkro_report, key)) {
+            nkro_key_count--;
+        }
         return;
     }
 #endif
@@ -182,6 +262,7 @@ void clear_keys_from_report(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        nkro_key_count = 0;
         return;
     }
 #endif
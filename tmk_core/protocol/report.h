@@ -339,8 +339,9 @@ bool    is_key_pressed(uint8_t key);
 void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 #ifdef NKRO_ENABLE
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code);
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool    add_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool    del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+uint8_t count_key_bits(report_nkro_t* nkro_report);
 #endif
 
 void add_key_to_report(uint8_t key);